@@ -13,10 +13,14 @@
 #include "genh5_globals.h"
 #include "genh5_version.h"
 #include "genh5_attribute.h"
+#include "genh5_bitdata.h"
+#include "genh5_compressiontuner.h"
 #include "genh5_dataset.h"
 #include "genh5_data.h"
 #include "genh5_file.h"
+#include "genh5_fileindex.h"
 #include "genh5_group.h"
+#include "genh5_readcontext.h"
 #include "genh5_reference.h"
 
 #endif // GENH5_H
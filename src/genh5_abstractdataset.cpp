@@ -8,6 +8,9 @@
  */
 
 #include "genh5_abstractdataset.h"
+#include "genh5_simd.h"
+
+#include <memory>
 
 GenH5::AbstractDataSet::AbstractDataSet() = default;
 
@@ -15,8 +18,8 @@ namespace GenH5
 {
 
 /// We want to check if the other datatype is a compound with compatible
-/// memory layout but has default member names. In this case we should use the
-/// datatype of the dataset so that the correct member names are used
+/// members but has default member names. In this case we should use the
+/// member names of the dataset (see `namedCompoundType`)
 inline bool isDefaultCompoundType(GenH5::DataType dtype, GenH5::DataType other)
 {
     // We have to check this only for compound types
@@ -37,9 +40,7 @@ inline bool isDefaultCompoundType(GenH5::DataType dtype, GenH5::DataType other)
 
     for (int i = 0; i < size; ++i)
     {
-        if (// the offset must be the same (identical memory layout)
-            tMembers[i].offset != oMembers[i].offset ||
-            // the meber type must be the same
+        if (// the meber type must be the same
             tMembers[i].type   != oMembers[i].type ||
             // names should not match
             tMembers[i].name   == oMembers[i].name ||
@@ -53,6 +54,31 @@ inline bool isDefaultCompoundType(GenH5::DataType dtype, GenH5::DataType other)
     return true;
 }
 
+/// Returns the memory type using the member names of the dataset. If the
+/// memory layout is identical this is the datatype of the dataset, else
+/// (i.e. the dataset is packed) the memory layout of `other` is kept
+inline DataType namedCompoundType(DataType const& dtype, DataType const& other)
+{
+    CompoundMembers const tMembers = dtype.compoundMembers();
+    CompoundMembers members = other.compoundMembers();
+
+    bool isSameLayout = dtype.size() == other.size();
+    for (int i = 0; i < members.size(); ++i)
+    {
+        isSameLayout &= tMembers[i].offset == members[i].offset;
+        members[i].name = tMembers[i].name;
+    }
+
+    if (isSameLayout) return dtype;
+
+    return DataType::compound(other.size(), members);
+}
+
+/// maximum size of the buffer used for converting data using the simd
+/// kernels. Larger selections are converted by HDF5, which uses a bounded
+/// buffer of the same size by default.
+constexpr size_t s_maxConversionBuffer = 1024 * 1024;
+
 } // namespace
 
 bool
@@ -75,10 +101,25 @@ GenH5::AbstractDataSet::write(void const* data, Optional<DataType> dtype) const
 
     auto type = dataType();
     // use the datatype of the dataset if not specified
-    if (dtype.isDefault() || isDefaultCompoundType(type, dtype))
+    if (dtype.isDefault())
     {
         dtype = type;
     }
+    else if (isDefaultCompoundType(type, dtype))
+    {
+        dtype = namedCompoundType(type, dtype);
+    }
+
+    // convert common numeric types using the simd kernels instead of HDF5
+    size_t const n = static_cast<size_t>(space.selectionSize());
+    if (n * type.size() <= s_maxConversionBuffer &&
+        details::isSimdConvertible(dtype, type))
+    {
+        std::unique_ptr<char[]> buffer{new char[n * type.size()]};
+
+        return details::simdConvert(data, dtype, buffer.get(), type, n) &&
+               doWrite(buffer.get(), type);
+    }
 
     return doWrite(data, dtype);
 }
@@ -103,10 +144,33 @@ GenH5::AbstractDataSet::read(void* data, Optional<DataType> dtype) const
 
     auto type = dataType();
     // use the datatype of the dataset if not specified
-    if (dtype.isDefault() || isDefaultCompoundType(type, dtype))
+    if (dtype.isDefault())
     {
         dtype = type;
     }
+    else if (isDefaultCompoundType(type, dtype))
+    {
+        dtype = namedCompoundType(type, dtype);
+    }
+
+    // convert common numeric types using the simd kernels instead of HDF5
+    size_t const n = static_cast<size_t>(space.selectionSize());
+    bool const inPlace = type.size() == dtype->size();
+    if ((inPlace || n * type.size() <= s_maxConversionBuffer) &&
+        details::isSimdConvertible(type, dtype))
+    {
+        // only the byte order differs: convert in place
+        if (inPlace)
+        {
+            return doRead(data, type) &&
+                   details::simdConvert(data, type, data, dtype, n);
+        }
+
+        std::unique_ptr<char[]> buffer{new char[n * type.size()]};
+
+        return doRead(buffer.get(), type) &&
+               details::simdConvert(buffer.get(), type, data, dtype, n);
+    }
 
     return doRead(data, dtype);
 }
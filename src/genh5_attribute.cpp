@@ -43,8 +43,9 @@ GenH5::Attribute::id() const noexcept
 bool
 GenH5::Attribute::doWrite(void const* data, DataType const& dtype) const
 {
-    File file = this->file();
-    if (auto hook = findHook(file, GenH5::PreAttributeWriteHook)) {
+    using details::findObjectHook;
+
+    if (auto hook = findObjectHook(id(), GenH5::PreAttributeWriteHook)) {
         GenH5::AttributeWriteHookContext context{data, &dtype};
         GenH5::HookReturnValue rvalue = hook(id(), &context);
         if (rvalue != GenH5::HookContinue)
@@ -55,7 +56,7 @@ GenH5::Attribute::doWrite(void const* data, DataType const& dtype) const
 
     herr_t err = H5Awrite(m_id, dtype.id(), data);
 
-    if (auto hook = findHook(file, GenH5::PostAttributeWriteHook)) {
+    if (auto hook = findObjectHook(id(), GenH5::PostAttributeWriteHook)) {
         GenH5::AttributeWriteHookContext context{data, &dtype};
         GenH5::HookReturnValue rvalue = hook(id(), &context);
         if (rvalue != GenH5::HookContinue)
@@ -70,15 +71,16 @@ GenH5::Attribute::doWrite(void const* data, DataType const& dtype) const
 bool
 GenH5::Attribute::doRead(void* data, DataType const& dtype) const
 {
-    File file = this->file();
-    if (auto hook = findHook(file, GenH5::PreAttributeReadHook)) {
+    using details::findObjectHook;
+
+    if (auto hook = findObjectHook(id(), GenH5::PreAttributeReadHook)) {
         GenH5::AttributeReadHookContext context{data, &dtype};
         hook(id(), &context);
     }
 
     herr_t err = H5Aread(m_id, dtype.id(), data);
 
-    if (auto hook = findHook(file, GenH5::PostAttributeReadHook)) {
+    if (auto hook = findObjectHook(id(), GenH5::PostAttributeReadHook)) {
         GenH5::AttributeReadHookContext context{data, &dtype};
         hook(id(), &context);
     }
@@ -0,0 +1,338 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#include "genh5_bitdata.h"
+#include "genh5_dataset.h"
+#include "genh5_group.h"
+#include "genh5_simd.h"
+
+#include <H5Tpublic.h>
+
+#include <cstring>
+#include <limits>
+
+namespace
+{
+
+/// number of bits set in the word
+inline size_t
+popCount(uint64_t x) noexcept
+{
+    x = x - ((x >> 1) & 0x5555555555555555ull);
+    x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0full;
+    return static_cast<size_t>((x * 0x0101010101010101ull) >> 56);
+}
+
+inline size_t
+bytesForBits(size_t bits) noexcept
+{
+    return (bits + 7) / 8;
+}
+
+/// number of bytes as the size of a vector
+inline int
+checkedByteCount(size_t bits) noexcept(false)
+{
+    if (bits > GenH5::BitData::maxSize())
+    {
+        throw GenH5::InvalidArgumentError{
+            GENH5_MAKE_EXECEPTION_STR() "Too many bits: " +
+            std::to_string(bits) + " (maximum: " +
+            std::to_string(GenH5::BitData::maxSize()) + ')'
+        };
+    }
+    return static_cast<int>(bytesForBits(bits));
+}
+
+/// number of bits stored in the dataset
+size_t
+storedBitCount(GenH5::DataSet const& dset) noexcept(false)
+{
+    using GenH5::BitData;
+
+    if (!GenH5::isBitDataSet(dset))
+    {
+        throw GenH5::DataSetException{
+            GENH5_MAKE_EXECEPTION_STR() "Reading bits failed "
+            "(dataset does not hold packed bits)"
+        };
+    }
+
+    return static_cast<size_t>(
+                dset.readAttribute0D<unsigned long long>(
+                    BitData::bitCountAttributeName()).value());
+}
+
+} // namespace
+
+GenH5::BitData::BitData() = default;
+
+GenH5::BitData::BitData(size_t size, bool value)
+{
+    resize(size, value);
+}
+
+GenH5::BitData::BitData(std::initializer_list<bool> values) :
+    BitData{fromBools(values.begin(), values.size())}
+{ }
+
+GenH5::BitData
+GenH5::BitData::fromBools(bool const* values, size_t size) noexcept(false)
+{
+    BitData data;
+    data.m_bytes.resize(checkedByteCount(size));
+    data.m_size = size;
+    if (size > 0) details::packBits(values, data.m_bytes.data(), size);
+    return data;
+}
+
+GenH5::DataType const&
+GenH5::BitData::dataType()
+{
+    static DataType type = DataType::fromId(H5Tcopy(H5T_STD_B8LE));
+    return type;
+}
+
+GenH5::String
+GenH5::BitData::bitCountAttributeName()
+{
+    return QByteArrayLiteral("GENH5_BIT_COUNT");
+}
+
+void
+GenH5::BitData::resize(size_t size, bool value) noexcept(false)
+{
+    size_t const oldSize = m_size;
+    // new bytes are zero
+    m_bytes.resize(checkedByteCount(size));
+    m_size = size;
+
+    if (value && size > oldSize)
+    {
+        // remaining bits of the last byte
+        if (oldSize % 8 != 0)
+        {
+            m_bytes[static_cast<int>(oldSize / 8)] |=
+                    static_cast<uint8_t>(0xff << (oldSize % 8));
+        }
+        size_t const begin = bytesForBits(oldSize);
+        std::memset(m_bytes.data() + begin, 0xff, m_bytes.size() - begin);
+    }
+
+    clearPadding();
+}
+
+bool
+GenH5::BitData::at(size_t idx) const noexcept(false)
+{
+    if (idx >= m_size)
+    {
+        throw InvalidArgumentError{
+            GENH5_MAKE_EXECEPTION_STR() "Bit index out of range: " +
+            std::to_string(idx)
+        };
+    }
+    return (*this)[idx];
+}
+
+void
+GenH5::BitData::set(size_t idx, bool value) noexcept(false)
+{
+    if (idx >= m_size)
+    {
+        throw InvalidArgumentError{
+            GENH5_MAKE_EXECEPTION_STR() "Bit index out of range: " +
+            std::to_string(idx)
+        };
+    }
+
+    auto& byte = m_bytes[static_cast<int>(idx / 8)];
+    uint8_t const mask = static_cast<uint8_t>(1u << (idx % 8));
+    byte = static_cast<uint8_t>(value ? byte | mask : byte & ~mask);
+}
+
+size_t
+GenH5::BitData::count() const noexcept
+{
+    size_t const n = m_bytes.size();
+    uint8_t const* bytes = m_bytes.constData();
+
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        count += popCount(word);
+    }
+    for (; i < n; ++i) count += popCount(bytes[i]);
+
+    return count;
+}
+
+void
+GenH5::BitData::toBools(bool* values) const noexcept
+{
+    if (m_size > 0) details::unpackBits(m_bytes.constData(), values, m_size);
+}
+
+GenH5::Vector<bool>
+GenH5::BitData::values() const noexcept(false)
+{
+    if (m_size > static_cast<size_t>(std::numeric_limits<int>::max()))
+    {
+        throw InvalidArgumentError{
+            GENH5_MAKE_EXECEPTION_STR() "Too many bits for a vector: " +
+            std::to_string(m_size)
+        };
+    }
+
+    Vector<bool> values(static_cast<int>(m_size));
+    toBools(values.data());
+    return values;
+}
+
+bool
+GenH5::BitData::operator==(BitData const& other) const noexcept
+{
+    // the padding bits are always zero
+    return m_size == other.m_size && m_bytes == other.m_bytes;
+}
+
+void
+GenH5::BitData::clearPadding() noexcept
+{
+    if (m_size % 8 != 0)
+    {
+        m_bytes.last() &= static_cast<uint8_t>((1u << (m_size % 8)) - 1);
+    }
+}
+
+GenH5::DataSet
+GenH5::writeBitDataSet(Group const& parent,
+                       String const& name,
+                       BitData const& data,
+                       Optional<DataSetCProperties> cProps) noexcept(false)
+{
+    auto dset = parent.createDataSet(name, BitData::dataType(),
+                                     DataSpace::linear(data.byteCount()),
+                                     std::move(cProps));
+
+    if (!data.isEmpty() && !dset.write(data.bytes(), BitData::dataType()))
+    {
+        throw DataSetException{
+            GENH5_MAKE_EXECEPTION_STR() "Writing bits failed"
+        };
+    }
+
+    dset.writeAttribute0D(BitData::bitCountAttributeName(),
+                          static_cast<unsigned long long>(data.size()));
+
+    return dset;
+}
+
+bool
+GenH5::isBitDataSet(DataSet const& dset) noexcept
+{
+    if (!dset.isValid() ||
+        !dset.hasAttribute(BitData::bitCountAttributeName()))
+    {
+        return false;
+    }
+
+    try
+    {
+        return dset.dataType() == BitData::dataType() &&
+               dset.dataSpace().nDims() == 1;
+    }
+    catch (Exception const&)
+    {
+        return false;
+    }
+}
+
+GenH5::BitData
+GenH5::readBitDataSet(DataSet const& dset) noexcept(false)
+{
+    size_t const size = storedBitCount(dset);
+
+    return BitData::read(dset, size, 0, size);
+}
+
+GenH5::BitData
+GenH5::readBitDataSet(DataSet const& dset,
+                      size_t offset,
+                      size_t count) noexcept(false)
+{
+    return BitData::read(dset, storedBitCount(dset), offset, count);
+}
+
+GenH5::BitData
+GenH5::BitData::read(DataSet const& dset,
+                     size_t size,
+                     size_t offset,
+                     size_t count) noexcept(false)
+{
+    if (offset > size || count > size - offset ||
+        bytesForBits(size) > dset.dataSpace().size())
+    {
+        throw DataSetException{
+            GENH5_MAKE_EXECEPTION_STR() "Reading bits failed "
+            "(range exceeds the number of bits)"
+        };
+    }
+
+    BitData data;
+    data.m_bytes.resize(checkedByteCount(count));
+    data.m_size = count;
+    if (count == 0) return data;
+
+    // bytes containing the bits
+    size_t const first = offset / 8;
+    size_t const nBytes = (offset + count - 1) / 8 - first + 1;
+    size_t const shift = offset % 8;
+
+    Vector<uint8_t> buffer;
+    uint8_t* dst = data.bytes();
+    if (shift != 0)
+    {
+        buffer.resize(static_cast<int>(nBytes));
+        dst = buffer.data();
+    }
+
+    DataSet copy{dset};
+    auto fileSpace = makeSelection(dset.dataSpace(),
+                                   Dimensions{static_cast<hsize_t>(nBytes)},
+                                   Dimensions{static_cast<hsize_t>(first)});
+    if (!copy.read(dst, fileSpace, DataSpace::linear(nBytes),
+                   BitData::dataType()))
+    {
+        throw DataSetException{
+            GENH5_MAKE_EXECEPTION_STR() "Reading bits failed"
+        };
+    }
+
+    // align the bits on byte boundaries
+    if (shift != 0)
+    {
+        uint8_t* bytes = data.bytes();
+        size_t const n = data.byteCount();
+        for (size_t i = 0; i < n; ++i)
+        {
+            unsigned const lo = buffer[static_cast<int>(i)] >> shift;
+            unsigned const hi = i + 1 < nBytes ?
+                        buffer[static_cast<int>(i + 1)] << (8 - shift) : 0;
+            bytes[i] = static_cast<uint8_t>(lo | hi);
+        }
+    }
+
+    data.clearPadding();
+    return data;
+}
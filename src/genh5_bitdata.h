@@ -0,0 +1,206 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#ifndef GENH5_BITDATA_H
+#define GENH5_BITDATA_H
+
+#include "genh5_datasetcproperties.h"
+#include "genh5_datatype.h"
+#include "genh5_optional.h"
+#include "genh5_typedefs.h"
+
+#include <initializer_list>
+#include <limits>
+#include <stdint.h>
+
+namespace GenH5
+{
+
+class DataSet;
+class Group;
+
+/**
+ * @brief The BitData class. Holds booleans packed into bits (least
+ * significant bit first), i.e. one eighth of the size of booleans. Is stored
+ * as a one dimensional dataset of 8 bit bitfields, the number of bits is
+ * stored in the attribute `bitCountAttributeName`. The remaining bits of the
+ * last byte are always zero. The packed bytes are stored in a `Vector`,
+ * thus at most `maxSize` bits can be held.
+ */
+class GENH5_EXPORT BitData
+{
+public:
+
+    BitData();
+    /// @throws InvalidArgumentError if the size exceeds `maxSize`
+    explicit BitData(size_t size, bool value = false);
+    BitData(std::initializer_list<bool> values);
+
+    /**
+     * @brief Maximum number of bits (the number of bytes of a `Vector` is
+     * limited to `INT_MAX`)
+     * @return Maximum number of bits
+     */
+    static constexpr size_t maxSize() noexcept
+    {
+        return static_cast<size_t>(std::numeric_limits<int>::max()) * 8;
+    }
+
+    /**
+     * @brief Packs the booleans
+     * @throws InvalidArgumentError if the size exceeds `maxSize`
+     * @param values Pointer to the booleans
+     * @param size Number of booleans
+     * @return Bit data
+     */
+    static BitData fromBools(bool const* values, size_t size) noexcept(false);
+
+    /**
+     * @brief Datatype of the packed bytes (8 bit bitfield)
+     * @return Datatype
+     */
+    static DataType const& dataType();
+
+    /**
+     * @brief Name of the attribute holding the number of bits
+     * @return Attribute name
+     */
+    static String bitCountAttributeName();
+
+    /// number of bits
+    size_t size() const noexcept { return m_size; }
+    bool isEmpty() const noexcept { return m_size == 0; }
+
+    /// number of bytes
+    size_t byteCount() const noexcept { return (m_size + 7) / 8; }
+
+    /**
+     * @brief Resizes the data. New bits are set to `value`.
+     * @throws InvalidArgumentError if the size exceeds `maxSize`
+     * @param size Number of bits
+     * @param value Value of new bits
+     */
+    void resize(size_t size, bool value = false) noexcept(false);
+
+    /// bit at index `idx` (unchecked)
+    bool operator[](size_t idx) const noexcept
+    {
+        return (m_bytes[static_cast<int>(idx / 8)] >> (idx % 8)) & 1;
+    }
+
+    /**
+     * @brief Bit at index `idx`
+     * @throws InvalidArgumentError if the index is out of range
+     * @param idx Index
+     * @return Value
+     */
+    bool at(size_t idx) const noexcept(false);
+
+    /**
+     * @brief Sets the bit at index `idx`
+     * @throws InvalidArgumentError if the index is out of range
+     * @param idx Index
+     * @param value Value
+     */
+    void set(size_t idx, bool value) noexcept(false);
+
+    /// number of bits set
+    size_t count() const noexcept;
+
+    /**
+     * @brief Unpacks the bits
+     * @param values Pointer to at least `size` booleans
+     */
+    void toBools(bool* values) const noexcept;
+
+    /**
+     * @brief Unpacks the bits
+     * @throws InvalidArgumentError if there are more than `INT_MAX` bits,
+     * use `toBools` instead
+     * @return Booleans
+     */
+    Vector<bool> values() const noexcept(false);
+
+    /// packed bytes
+    uint8_t const* bytes() const noexcept { return m_bytes.constData(); }
+    uint8_t* bytes() noexcept { return m_bytes.data(); }
+
+    bool operator==(BitData const& other) const noexcept;
+    bool operator!=(BitData const& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+private:
+
+    /// packed bits
+    Vector<uint8_t> m_bytes;
+    /// number of bits
+    size_t m_size{0};
+
+    /// sets the remaining bits of the last byte to zero
+    void clearPadding() noexcept;
+
+    /// reads `count` bits starting at bit `offset` from a dataset holding
+    /// `size` bits
+    static BitData read(DataSet const& dset, size_t size,
+                        size_t offset, size_t count) noexcept(false);
+
+    friend GENH5_EXPORT BitData readBitDataSet(DataSet const&) noexcept(false);
+    friend GENH5_EXPORT BitData readBitDataSet(DataSet const&, size_t,
+                                               size_t) noexcept(false);
+};
+
+/**
+ * @brief Creates and writes a dataset holding the packed bits
+ * @param parent Parent group
+ * @param name Name of the dataset
+ * @param data Bits to write
+ * @param cProps Optional create properties
+ * @return Dataset
+ */
+GENH5_EXPORT DataSet writeBitDataSet(Group const& parent,
+                                     String const& name,
+                                     BitData const& data,
+                                     Optional<DataSetCProperties> cProps = {}
+                                     ) noexcept(false);
+
+/**
+ * @brief Whether the dataset holds packed bits (see `writeBitDataSet`)
+ * @param dset Dataset
+ * @return Whether the dataset holds packed bits
+ */
+GENH5_EXPORT bool isBitDataSet(DataSet const& dset) noexcept;
+
+/**
+ * @brief Reads the packed bits of the dataset
+ * @throws DataSetException if the dataset does not hold packed bits or
+ * reading failed
+ * @param dset Dataset
+ * @return Bits
+ */
+GENH5_EXPORT BitData readBitDataSet(DataSet const& dset) noexcept(false);
+
+/**
+ * @brief Reads `count` bits starting at bit `offset`. Only the bytes
+ * containing the bits are read.
+ * @throws DataSetException if the dataset does not hold packed bits, the
+ * range exceeds the number of bits or reading failed
+ * @param dset Dataset
+ * @param offset Index of the first bit
+ * @param count Number of bits
+ * @return Bits
+ */
+GENH5_EXPORT BitData readBitDataSet(DataSet const& dset,
+                                    size_t offset,
+                                    size_t count) noexcept(false);
+
+} // namespace GenH5
+
+#endif // GENH5_BITDATA_H
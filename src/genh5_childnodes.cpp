@@ -0,0 +1,326 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#include "genh5_childnodes.h"
+#include "genh5_private.h"
+
+#include "H5Gpublic.h"
+
+#include <cstring>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+
+/// maximum number of links retrieved by a single iteration step
+constexpr size_t s_batchSize = 256;
+
+/// link retrieved by an iteration step
+struct LinkData
+{
+    GenH5::String name{};
+    H5L_info_t info{};
+};
+
+/// appends the link and stops the iteration once the batch is full
+herr_t
+fetchLinks(hid_t /*groupId*/, char const* name,
+           H5L_info_t const* info, void* dataPtr)
+{
+    assert(dataPtr);
+
+    auto* links = static_cast<std::vector<LinkData>*>(dataPtr);
+    links->push_back(LinkData{QByteArray{name}, *info});
+    return links->size() < s_batchSize ? 0 : 1;
+}
+
+/// group currently iterated over
+struct Frame
+{
+    GenH5::Group group{};
+    /// path of the group relative to the root of the iteration
+    GenH5::String prefix{};
+    /// index of the next link to retrieve
+    ::hsize_t idx{};
+    /// depth of the child nodes
+    int depth{};
+    /// links retrieved but not yet visited
+    std::vector<LinkData> links{};
+    /// index of the next link in `links`
+    size_t pos{};
+    /// whether all links were retrieved
+    bool complete{false};
+};
+
+struct TokenHash
+{
+    size_t operator()(H5O_token_t const& token) const
+    {
+        return std::hash<std::string_view>{}(std::string_view{
+            reinterpret_cast<char const*>(token.__data), sizeof(token.__data)
+        });
+    }
+};
+
+struct TokenEqual
+{
+    bool operator()(H5O_token_t const& a, H5O_token_t const& b) const
+    {
+        return std::memcmp(a.__data, b.__data, sizeof(a.__data)) == 0;
+    }
+};
+
+} // namespace
+
+struct GenH5::ChildNodes::Impl
+{
+    Group root{};
+    IterationFilter filter{};
+    H5_index_t index{};
+    H5_iter_order_t order{};
+    bool recursive{false};
+    bool resolveTypes{false};
+    int maxDepth{-1};
+
+    bool started{false};
+    /// groups that are currently iterated over
+    std::vector<Frame> stack{};
+    /// groups with multiple hard links that were already visited
+    std::unordered_set<H5O_token_t, TokenHash, TokenEqual> visited{};
+
+    /// current node
+    NodeInfo current{};
+    int currentDepth{};
+    /// link name of the current node relative to its group
+    String currentName{};
+    /// whether to descend into the current node when advancing
+    bool descend{false};
+
+    /// returns true if the group was visited before, otherwise marks it
+    bool checkVisited(H5O_info2_t const& objInfo)
+    {
+        // only groups with multiple hard links may be visited twice
+        if (objInfo.rc <= 1) return false;
+
+        return !visited.insert(objInfo.token).second;
+    }
+
+    /// whether the object type of each node must be retrieved
+    bool needsTypes() const
+    {
+        return resolveTypes || recursive || filter != NoFilter;
+    }
+};
+
+GenH5::NodeInfo const&
+GenH5::ChildNodes::iterator::operator*() const
+{
+    assert(m_range);
+    return m_range->m_impl->current;
+}
+
+GenH5::ChildNodes::iterator&
+GenH5::ChildNodes::iterator::operator++()
+{
+    assert(m_range);
+    if (!m_range->advance())
+    {
+        m_range = nullptr;
+    }
+    return *this;
+}
+
+GenH5::ChildNodes::ChildNodes(Group const& parent,
+                              IterationType iterType,
+                              IterationFilter iterFilter,
+                              IterationIndex iterIndex,
+                              IterationOrder iterOrder) noexcept(false) :
+    m_impl{std::make_unique<Impl>()}
+{
+    if (!parent.isValid())
+    {
+        throw GroupException{
+            GENH5_MAKE_EXECEPTION_STR()
+            "Iterating over child nodes failed (invalid parent)"
+        };
+    }
+
+    m_impl->root = parent;
+    m_impl->filter = iterFilter;
+    m_impl->index = static_cast<H5_index_t>(iterIndex);
+    m_impl->order = static_cast<H5_iter_order_t>(iterOrder);
+    m_impl->recursive = iterType == FindRecursive;
+}
+
+GenH5::ChildNodes::~ChildNodes() = default;
+
+GenH5::ChildNodes::ChildNodes(ChildNodes&& other) noexcept = default;
+
+GenH5::ChildNodes&
+GenH5::ChildNodes::operator=(ChildNodes&& other) noexcept = default;
+
+GenH5::ChildNodes&
+GenH5::ChildNodes::setMaxDepth(int depth) & noexcept
+{
+    assert(m_impl);
+    m_impl->maxDepth = depth;
+    return *this;
+}
+
+GenH5::ChildNodes
+GenH5::ChildNodes::setMaxDepth(int depth) && noexcept
+{
+    setMaxDepth(depth);
+    return std::move(*this);
+}
+
+GenH5::ChildNodes&
+GenH5::ChildNodes::setResolveTypes(bool resolve) & noexcept
+{
+    assert(m_impl);
+    m_impl->resolveTypes = resolve;
+    return *this;
+}
+
+GenH5::ChildNodes
+GenH5::ChildNodes::setResolveTypes(bool resolve) && noexcept
+{
+    setResolveTypes(resolve);
+    return std::move(*this);
+}
+
+void
+GenH5::ChildNodes::skipChildren() noexcept
+{
+    assert(m_impl);
+    m_impl->descend = false;
+}
+
+int
+GenH5::ChildNodes::depth() const noexcept
+{
+    assert(m_impl);
+    return m_impl->currentDepth;
+}
+
+GenH5::ChildNodes::iterator
+GenH5::ChildNodes::begin() noexcept
+{
+    assert(m_impl);
+    if (m_impl->started)
+    {
+        log::ErrStream()
+                << GENH5_MAKE_EXECEPTION_STR()
+                   "Child nodes can only be iterated over once!";
+        return end();
+    }
+
+    m_impl->started = true;
+
+    // the root group may be reachable by its child nodes
+    H5O_info2_t objInfo{};
+    if (H5Oget_info3(m_impl->root.id(), &objInfo, H5O_INFO_BASIC) >= 0)
+    {
+        m_impl->checkVisited(objInfo);
+    }
+
+    m_impl->stack.push_back(Frame{m_impl->root, {}, 0, 1});
+
+    return advance() ? iterator{this} : end();
+}
+
+bool
+GenH5::ChildNodes::advance() noexcept
+{
+    auto& d = *m_impl;
+
+    while (!d.stack.empty())
+    {
+        // descend into the previous node
+        if (d.descend)
+        {
+            d.descend = false;
+
+            hid_t id = H5Gopen(d.stack.back().group.id(),
+                               d.currentName.constData(), H5P_DEFAULT);
+            if (id >= 0)
+            {
+                auto cleanup = finally(H5Gclose, id);
+                Q_UNUSED(cleanup)
+
+                d.stack.push_back(Frame{Group{id}, d.current.path + '/',
+                                        0, d.currentDepth + 1});
+            }
+        }
+
+        auto& frame = d.stack.back();
+
+        // retrieve the next batch of links
+        if (frame.pos == frame.links.size())
+        {
+            if (frame.complete)
+            {
+                d.stack.pop_back();
+                continue;
+            }
+
+            frame.links.clear();
+            frame.pos = 0;
+            herr_t err = H5Literate(frame.group.id(), d.index, d.order,
+                                    &frame.idx, fetchLinks, &frame.links);
+            // iteration did not stop early -> group exhausted
+            frame.complete = err <= 0;
+            if (err < 0 || frame.links.empty())
+            {
+                d.stack.pop_back();
+                continue;
+            }
+        }
+
+        auto& link = frame.links[frame.pos++];
+
+        // retrieve only the basic object info and only if required
+        H5O_info2_t objInfo{};
+        IdType type = IdType::BadId;
+        if (d.needsTypes() &&
+            H5Oget_info_by_name3(frame.group.id(), link.name.constData(),
+                                 &objInfo, H5O_INFO_BASIC, H5P_DEFAULT) >= 0)
+        {
+            type = alg::toIdType(objInfo.type);
+        }
+
+        // same as H5Lvisit, soft links are not followed
+        bool descend = type == IdType::Group &&
+                       link.info.type == H5L_TYPE_HARD && d.recursive &&
+                       (d.maxDepth < 0 || frame.depth < d.maxDepth) &&
+                       !d.checkVisited(objInfo);
+
+        bool accepted = !(d.filter == FilterGroups && type != IdType::Group) &&
+                        !(d.filter == FilterDataSets && type != IdType::DataSet);
+
+        d.current.path = frame.prefix + link.name;
+        d.current.type = type;
+        d.current.corder = link.info.corder_valid ? link.info.corder : -1;
+        std::memcpy(d.current.token.__data, link.info.u.token.__data,
+                    sizeof(link.info.u.token.__data));
+        d.currentDepth = frame.depth;
+        d.currentName = std::move(link.name);
+        d.descend = descend;
+
+        // filtered out nodes are still descended into
+        if (accepted)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
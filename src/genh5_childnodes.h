@@ -0,0 +1,152 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#ifndef GENH5_CHILDNODES_H
+#define GENH5_CHILDNODES_H
+
+#include "genh5_node.h"
+
+#include <iterator>
+#include <memory>
+
+namespace GenH5
+{
+
+/**
+ * @brief The ChildNodes class. Lazy input range over the child nodes of a
+ * group. The links are retrieved in small batches by resuming the iteration
+ * at the index of the last link, thus breaking out of a loop early does not
+ * visit the remaining nodes. The object type of a node is only retrieved if
+ * required (i.e. for filtered or recursive iterations or if enabled using
+ * `setResolveTypes`), otherwise it is `IdType::BadId`. Recursive iterations visit the nodes depth
+ * first (i.e. in the same order as `Group::findChildNodes`). Subtrees can be
+ * pruned using `skipChildren` and the depth can be limited using
+ * `setMaxDepth`. The range can only be iterated once.
+ */
+class GENH5_EXPORT ChildNodes
+{
+    struct Impl;
+
+public:
+
+    /**
+     * @brief The iterator class. Input iterator, advancing the iterator
+     * retrieves the next node.
+     */
+    class GENH5_EXPORT iterator
+    {
+    public:
+
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = NodeInfo;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = NodeInfo const*;
+        using reference         = NodeInfo const&;
+
+        iterator() = default;
+
+        reference operator*() const;
+        pointer operator->() const { return &**this; }
+
+        iterator& operator++();
+        // only the current node is accessible, thus no copy is returned
+        void operator++(int) { ++*this; }
+
+        bool operator==(iterator const& other) const
+        {
+            return m_range == other.m_range;
+        }
+        bool operator!=(iterator const& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+
+        explicit iterator(ChildNodes* range) : m_range{range} { }
+
+        /// range iterated over, null if exhausted
+        ChildNodes* m_range{};
+
+        friend class ChildNodes;
+    };
+
+    /**
+     * @brief Prepares the iteration over the child nodes of parent. No node
+     * is accessed until `begin` is called.
+     * @param parent Parent group
+     * @param iterType Iteration type (i.e. direct only or all recursive)
+     * @param iterFilter Filter to use. Groups are descended into even if
+     * they are filtered out.
+     * @param iterIndex Indexing type
+     * @param iterOrder Order of the nodes within a group
+     */
+    ChildNodes(Group const& parent,
+               IterationType iterType = FindDirectOnly,
+               IterationFilter iterFilter = NoFilter,
+               IterationIndex iterIndex = IndexName,
+               IterationOrder iterOrder = NativeOrder) noexcept(false);
+    ~ChildNodes();
+
+    ChildNodes(ChildNodes&& other) noexcept;
+    ChildNodes& operator=(ChildNodes&& other) noexcept;
+
+    /**
+     * @brief Limits the depth of a recursive iteration. Direct child nodes
+     * have a depth of 1. A negative depth does not limit the iteration. Has
+     * no effect on direct only iterations.
+     * @param depth Maximum depth
+     * @return This
+     */
+    ChildNodes& setMaxDepth(int depth) & noexcept;
+    // returns a new range, such that temporaries can be used in loops
+    ChildNodes setMaxDepth(int depth) && noexcept;
+
+    /**
+     * @brief Retrieves the object type of each node even if it is not
+     * required by the iteration (i.e. for direct, unfiltered iterations).
+     * Requires accessing the object header of each node.
+     * @param resolve Whether to retrieve the object types
+     * @return This
+     */
+    ChildNodes& setResolveTypes(bool resolve = true) & noexcept;
+    // returns a new range, such that temporaries can be used in loops
+    ChildNodes setResolveTypes(bool resolve = true) && noexcept;
+
+    /**
+     * @brief Does not descend into the current node (i.e. prunes its
+     * subtree). Has only an effect on recursive iterations.
+     */
+    void skipChildren() noexcept;
+
+    /**
+     * @brief Depth of the current node. Direct child nodes have a depth of 1.
+     * @return Depth
+     */
+    int depth() const noexcept;
+
+    /**
+     * @brief Starts the iteration and retrieves the first node.
+     * @return Iterator
+     */
+    iterator begin() noexcept;
+    iterator end() noexcept { return iterator{}; }
+
+private:
+
+    /// iteration state
+    std::unique_ptr<Impl> m_impl;
+
+    /// retrieves the next node, returns false if the iteration has ended
+    bool advance() noexcept;
+};
+
+} // namespace GenH5
+
+#endif // GENH5_CHILDNODES_H
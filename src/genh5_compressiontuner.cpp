@@ -0,0 +1,364 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#include "genh5_compressiontuner.h"
+#include "genh5_file.h"
+#include "genh5_group.h"
+#include "genh5_private.h"
+
+#include <H5Dpublic.h>
+#include <H5FDcore.h>
+#include <H5Ppublic.h>
+#include <H5Tpublic.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <functional>
+#include <limits>
+
+namespace
+{
+
+/// number of chunks used as a sample
+constexpr size_t s_sampleChunks = 4;
+
+/// nominal decompression throughputs in bytes of raw data per second. Only
+/// their relation matters, thus they are fixed instead of measured.
+constexpr double s_mib = 1 << 20;
+constexpr double s_shuffleThroughput = 4000 * s_mib;
+constexpr double s_lz4Throughput     = 2500 * s_mib;
+constexpr double s_zstdThroughput    = 1000 * s_mib;
+constexpr double s_deflateThroughput =  300 * s_mib;
+
+/// read time tolerance relative to the fastest trial for each goal
+inline double
+readTimeTolerance(GenH5::CompressionGoal goal)
+{
+    switch (goal)
+    {
+    case GenH5::GoalReadSpeed:
+        return 1.1;
+    case GenH5::GoalBalanced:
+        return 2.0;
+    case GenH5::GoalRatio:
+        break;
+    }
+    return std::numeric_limits<double>::max();
+}
+
+/// filters of a candidate
+using FilterSetter = std::function<void(GenH5::DataSetCProperties&)>;
+
+/// filters and the time to decode one byte of raw data
+struct Candidate
+{
+    FilterSetter setFilters;
+    double decodeCost;
+};
+
+/// candidates are ordered from cheap to expensive, such that on equal
+/// ratios the cheaper one is selected
+GenH5::Vector<Candidate>
+filterCandidates(size_t typeSize)
+{
+    using GenH5::DataSetCProperties;
+
+    bool const lz4  = GenH5::isFilterAvailable(GenH5::FilterLz4);
+    bool const zstd = GenH5::isFilterAvailable(GenH5::FilterZstd);
+    // shuffling single bytes has no effect
+    bool const shuffle = typeSize > 1;
+
+    GenH5::Vector<Candidate> candidates;
+    // no filters
+    candidates.push_back({[](DataSetCProperties&){ }, 0.0});
+
+    auto add = [&](FilterSetter setter, double throughput){
+        candidates.push_back({setter, 1 / throughput});
+        if (shuffle)
+        {
+            candidates.push_back({[=](DataSetCProperties& props){
+                props.setShuffle();
+                setter(props);
+            }, 1 / throughput + 1 / s_shuffleThroughput});
+        }
+    };
+
+    if (lz4)
+    {
+        add([](DataSetCProperties& props){ props.setLz4(); },
+            s_lz4Throughput);
+    }
+    add([](DataSetCProperties& props){ props.setDeflate(1); },
+        s_deflateThroughput);
+    if (zstd)
+    {
+        add([](DataSetCProperties& props){ props.setZstd(3); },
+            s_zstdThroughput);
+    }
+    add([](DataSetCProperties& props){ props.setDeflate(5); },
+        s_deflateThroughput);
+    if (zstd)
+    {
+        add([](DataSetCProperties& props){ props.setZstd(9); },
+            s_zstdThroughput);
+    }
+    add([](DataSetCProperties& props){ props.setDeflate(9); },
+        s_deflateThroughput);
+
+    return candidates;
+}
+
+/// whether the datatype references data of variable length
+bool
+isVariableLength(hid_t id)
+{
+    switch (H5Tget_class(id))
+    {
+    case H5T_VLEN:
+        return true;
+    case H5T_STRING:
+        return H5Tis_variable_str(id) > 0;
+    case H5T_ARRAY:
+    {
+        hid_t super = H5Tget_super(id);
+        auto cleanup = GenH5::finally(H5Tclose, super);
+        Q_UNUSED(cleanup)
+        return isVariableLength(super);
+    }
+    case H5T_COMPOUND:
+    {
+        int n = H5Tget_nmembers(id);
+        for (int i = 0; i < n; ++i)
+        {
+            hid_t member = H5Tget_member_type(id, static_cast<uint>(i));
+            auto cleanup = GenH5::finally(H5Tclose, member);
+            Q_UNUSED(cleanup)
+            if (isVariableLength(member)) return true;
+        }
+        return false;
+    }
+    default:
+        return false;
+    }
+}
+
+/// creates a file that is only held in memory
+GenH5::File
+createMemoryFile() noexcept(false)
+{
+    static std::atomic<int> counter{0};
+
+    hid_t fapl = H5Pcreate(H5P_FILE_ACCESS);
+    auto cleanup = GenH5::finally(H5Pclose, fapl);
+    Q_UNUSED(cleanup)
+
+    // the name must be unique, but no file is written
+    auto name = QByteArrayLiteral("genh5_compression_trial_") +
+                QByteArray::number(counter++) + QByteArrayLiteral(".h5");
+
+    hid_t id = -1;
+    if (fapl >= 0 && H5Pset_fapl_core(fapl, 1 << 20, false) >= 0)
+    {
+        id = H5Fcreate(name.constData(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    }
+
+    if (id < 0)
+    {
+        throw GenH5::FileException{
+            GENH5_MAKE_EXECEPTION_STR() "Creating in-memory file failed"
+        };
+    }
+
+    return GenH5::File::fromId(id);
+}
+
+/// chunk dimensions must not exceed the extent of the sample
+GenH5::Dimensions
+clampedChunk(GenH5::Dimensions chunk, GenH5::Dimensions const& dims)
+{
+    for (int i = 0; i < chunk.size(); ++i)
+    {
+        chunk[i] = std::max<hsize_t>(std::min(chunk[i], dims[i]), 1);
+    }
+    return chunk;
+}
+
+/// writes the sample using the candidate and estimates the read time
+GenH5::CompressionTrial
+runTrial(GenH5::Group const& root,
+         void const* data,
+         GenH5::DataType const& dtype,
+         GenH5::DataSpace const& sampleSpace,
+         GenH5::Dimensions const& chunk,
+         Candidate const& candidate,
+         double storageThroughput) noexcept(false)
+{
+    GenH5::DataSetCProperties trialProps{
+        clampedChunk(chunk, sampleSpace.dimensions())
+    };
+    candidate.setFilters(trialProps);
+
+    auto dset = root.createDataSet(QByteArrayLiteral("trial"), dtype,
+                                   sampleSpace, trialProps);
+    if (!dset.write(data, dtype))
+    {
+        throw GenH5::DataSetException{
+            GENH5_MAKE_EXECEPTION_STR() "Writing compression trial failed"
+        };
+    }
+
+    size_t const rawSize = dtype.size() * sampleSpace.size();
+    hsize_t const storageSize = H5Dget_storage_size(dset.id());
+
+    // free the memory of the trial
+    dset.deleteLink();
+
+    GenH5::CompressionTrial trial;
+    trial.ratio = storageSize > 0 ? double(rawSize) / storageSize : 1.0;
+    trial.readTime = rawSize * candidate.decodeCost +
+                     storageSize / storageThroughput;
+
+    // final properties using the chunk dimensions of the dataset
+    trial.properties = GenH5::DataSetCProperties{chunk};
+    candidate.setFilters(trial.properties);
+
+    return trial;
+}
+
+/// selects the trial with the highest ratio within the read time tolerance
+GenH5::CompressionTrial const&
+selectTrial(GenH5::Vector<GenH5::CompressionTrial> const& trials,
+            GenH5::CompressionGoal goal)
+{
+    assert(!trials.empty());
+
+    double fastest = std::numeric_limits<double>::max();
+    for (auto const& trial : trials)
+    {
+        fastest = std::min(fastest, trial.readTime);
+    }
+
+    double const tolerance = readTimeTolerance(goal);
+
+    int selected = -1;
+    for (int i = 0; i < trials.size(); ++i)
+    {
+        auto const& trial = trials[i];
+        if (trial.readTime > fastest * tolerance) continue;
+
+        if (selected < 0 || trial.ratio > trials[selected].ratio)
+        {
+            selected = i;
+        }
+    }
+
+    return trials[std::max(selected, 0)];
+}
+
+} // namespace
+
+GenH5::CompressionTrial
+GenH5::tuneCompression(void const* data,
+                       DataType const& dtype,
+                       DataSpace const& sampleSpace,
+                       DataSpace const& dataspace,
+                       CompressionGoal goal,
+                       double storageThroughput) noexcept(false)
+{
+    if (!data || sampleSpace.nDims() != dataspace.nDims())
+    {
+        throw InvalidArgumentError{
+            GENH5_MAKE_EXECEPTION_STR() "Tuning compression failed "
+            "(invalid data or rank of the sample does not match)"
+        };
+    }
+    if (!(storageThroughput > 0))
+    {
+        throw InvalidArgumentError{
+            GENH5_MAKE_EXECEPTION_STR() "Tuning compression failed "
+            "(storage throughput must be positive)"
+        };
+    }
+
+    CompressionTrial result;
+
+    // nothing to compress
+    if (sampleSpace.nDims() == 0 || sampleSpace.size() == 0 ||
+        isVariableLength(dtype.id()))
+    {
+        result.properties =
+                DataSetCProperties::defaultProperties(dataspace, dtype);
+        return result;
+    }
+
+    size_t const typeSize = dtype.size();
+
+    // sample only the leading rows, which are stored contiguously
+    auto sampleDims = sampleSpace.dimensions();
+    hsize_t const rowSize = sampleSpace.size() / sampleDims[0];
+    size_t const maxSampleSize =
+            s_sampleChunks * DataSetCProperties::defaultChunkSize();
+    sampleDims[0] = std::max<hsize_t>(
+                std::min<hsize_t>(sampleDims[0],
+                                  maxSampleSize / (rowSize * typeSize)), 1);
+    DataSpace sample(sampleDims);
+
+    // chunk shapes
+    Vector<Dimensions> chunks;
+    for (ChunkAccess access : {ChunkTiled, ChunkRowWise, ChunkColumnWise})
+    {
+        auto chunk = DataSetCProperties::autoChunk(dataspace, dtype, access);
+        if (!chunks.contains(chunk)) chunks.push_back(chunk);
+    }
+
+    File file = createMemoryFile();
+    auto const& root = file.root();
+
+    // select filters using the first chunk shape
+    auto const candidates = filterCandidates(typeSize);
+
+    Vector<CompressionTrial> trials;
+    trials.reserve(candidates.size());
+    for (auto const& candidate : candidates)
+    {
+        trials.push_back(runTrial(root, data, dtype, sample, chunks.front(),
+                                  candidate, storageThroughput));
+    }
+
+    int const filterIdx = static_cast<int>(
+                &selectTrial(trials, goal) - trials.constData());
+
+    // select chunk shape using the selected filters
+    if (chunks.size() > 1 && filterIdx > 0)
+    {
+        Vector<CompressionTrial> shapes{trials[filterIdx]};
+        for (int i = 1; i < chunks.size(); ++i)
+        {
+            shapes.push_back(runTrial(root, data, dtype, sample, chunks[i],
+                                      candidates[filterIdx],
+                                      storageThroughput));
+        }
+        // only the ratio is compared, the filters are the same
+        result = selectTrial(shapes, GoalRatio);
+    }
+    else
+    {
+        result = trials[filterIdx];
+    }
+
+    // uncompressed data uses the default layout
+    if (filterIdx == 0)
+    {
+        result.properties =
+                DataSetCProperties::defaultProperties(dataspace, dtype);
+    }
+
+    return result;
+}
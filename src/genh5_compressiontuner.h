@@ -0,0 +1,110 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#ifndef GENH5_COMPRESSIONTUNER_H
+#define GENH5_COMPRESSIONTUNER_H
+
+#include "genh5_datasetcproperties.h"
+#include "genh5_dataspace.h"
+#include "genh5_datatype.h"
+#include "genh5_optional.h"
+#include "genh5_data/base.h"
+
+namespace GenH5
+{
+
+/**
+ * @brief The CompressionGoal enum. Goal of the compression tuner.
+ */
+enum CompressionGoal : int
+{
+    /// smallest file size regardless of the read speed
+    GoalRatio = 0,
+    /// fastest reads, compresses only if reading is (almost) not slowed down
+    GoalReadSpeed = 1,
+    /// good compression ratio while reading at most twice as slow
+    GoalBalanced = 2
+};
+
+/**
+ * @brief The CompressionTrial struct. Result of a trial compression.
+ */
+struct GENH5_EXPORT CompressionTrial
+{
+    /// create properties used (chunk dimensions and filters)
+    DataSetCProperties properties{};
+    /// size of the raw data divided by the size of the compressed data
+    double ratio{1.0};
+    /// estimated time to read the sample in seconds. Includes the time to
+    /// decompress the data, based on a nominal throughput of each filter, and
+    /// the time to read the stored data
+    double readTime{0.0};
+};
+
+/// Default throughput of the storage in bytes per second used to estimate
+/// read times (500 MiB/s)
+constexpr double defaultStorageThroughput = 500.0 * (1 << 20);
+
+/**
+ * @brief Trial-compresses a sample of the data using the available filters
+ * (deflate, shuffle, LZ4 and Zstandard) and chunk shapes and selects the
+ * best settings for the given goal. The trial datasets are written to an
+ * in-memory file. Only the leading rows of the data up to a few chunks are
+ * used as a sample. Variable length data is not compressed.
+ *
+ * Read times are not measured but estimated from the compression ratio, a
+ * nominal decompression throughput of each filter and the storage
+ * throughput. Thus the result depends only on the data and the arguments.
+ * @param data Pointer to the data in row major order
+ * @param dtype Datatype of the data
+ * @param sampleSpace Dataspace of the data
+ * @param dataspace Dataspace of the dataset to create. Chunk dimensions are
+ * computed for this dataspace. Must have the same rank as the sample.
+ * @param goal Compression goal
+ * @param storageThroughput Throughput of the storage in bytes per second.
+ * The slower the storage the more is gained by compressing the data.
+ * @return Trial of the selected settings. The ratio and read time refer to
+ * the sample.
+ */
+GENH5_EXPORT CompressionTrial tuneCompression(
+        void const* data,
+        DataType const& dtype,
+        DataSpace const& sampleSpace,
+        DataSpace const& dataspace,
+        CompressionGoal goal,
+        double storageThroughput = defaultStorageThroughput) noexcept(false);
+
+/**
+ * @brief Overload. Selects the create properties for a dataset holding
+ * `sample` or, if set, for a dataset with the dataspace `dataspace`.
+ * @param sample Sample data
+ * @param goal Compression goal
+ * @param dataspace Optional dataspace of the dataset to create
+ * @param storageThroughput Throughput of the storage in bytes per second
+ * @return create properties
+ */
+template <typename T>
+inline DataSetCProperties
+tuneCompression(details::AbstractData<T> const& sample,
+                CompressionGoal goal = GoalBalanced,
+                Optional<DataSpace> dataspace = {},
+                double storageThroughput = defaultStorageThroughput
+                ) noexcept(false)
+{
+    auto sampleSpace = sample.dataSpace();
+    if (dataspace.isDefault()) dataspace = sampleSpace;
+
+    return tuneCompression(sample.dataWritePtr(), sample.dataType(),
+                           sampleSpace, dataspace, goal,
+                           storageThroughput).properties;
+}
+
+} // namespace GenH5
+
+#endif // GENH5_COMPRESSIONTUNER_H
@@ -12,6 +12,9 @@
 
 #include "genh5_data/comp.h"
 #include "genh5_data/comp0d.h"
+#include "genh5_data/column.h"
+#include "genh5_data/dictionary.h"
 #include "genh5_data/fixedstring0d.h"
+#include "genh5_data/view.h"
 
 #endif // GENH5_DATA_H
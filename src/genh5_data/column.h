@@ -0,0 +1,259 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#ifndef GENH5_DATA_COLUMN_H
+#define GENH5_DATA_COLUMN_H
+
+#include "genh5_data/common.h"
+#include "genh5_mpl.h"
+#include "genh5_exception.h"
+
+namespace GenH5
+{
+
+/**
+ * @brief The ColumnData class. Struct-of-arrays variant of CompData. Each
+ * compound member is stored in its own contiguous container (column), thus
+ * scanning a single member does not stride over the other members.
+ * The compound datatype is the same as the one of the equivalent CompData,
+ * however each column is read separately using a memory type that only
+ * consists of the corresponding member. When writing, the columns are
+ * interleaved into a temporary buffer and written at once.
+ */
+template<typename... Ts>
+class ColumnData
+{
+    static_assert(sizeof...(Ts) > 1,
+                  "ColumnData requires at least two members, use Data<T> for "
+                  "a single member!");
+
+public:
+
+    using compound_names = CompoundNames<sizeof...(Ts)>;
+    using columns_type   = std::tuple<Data<Ts>...>;
+    using size_type      = typename Data<traits::comp_element_t<
+                                         0, Comp<Ts...>>>::size_type;
+
+    template <size_t tidx>
+    using column_type = Data<traits::comp_element_t<tidx, Comp<Ts...>>>;
+
+    static constexpr auto compoundSize() { return sizeof...(Ts); }
+
+    ColumnData() = default;
+
+    /** constructor **/
+    // types names only
+    explicit ColumnData(compound_names names) :
+        m_typeNames{std::move(names)}
+    { }
+    // template container types
+    template <typename... Containers,
+              traits::if_equal<sizeof...(Ts), sizeof...(Containers)> = true,
+              traits::if_types_equal<Comp<traits::value_t<Containers>...>,
+                                     Comp<traits::convert_to_t<Ts>...>> = true>
+    // cppcheck-suppress noExplicitConstructor
+    ColumnData(Containers&&... containers) noexcept(false)
+    {
+        push_back(std::forward<Containers>(containers)...);
+    }
+
+    /** push_back **/
+    // template container types, appends each container to its column
+    template <typename... Containers,
+              traits::if_equal<sizeof...(Ts), sizeof...(Containers)> = true,
+              traits::if_types_equal<Comp<traits::value_t<Containers>...>,
+                                     Comp<traits::convert_to_t<Ts>...>> = true>
+    void push_back(Containers&&... containersIn) noexcept(false)
+    {
+        auto containers = std::make_tuple(&containersIn...);
+        auto size = static_cast<size_type>(get<0>(containers)->size());
+
+        mpl::static_for<sizeof...(Ts)>([&](auto const idx){
+            if (size != static_cast<size_type>(get<idx>(containers)->size()))
+            {
+                throw InvalidArgumentError{
+                    GENH5_MAKE_EXECEPTION_STR_ID("ColumnData::push_back")
+                    "Arguments have different number of elements (" +
+                    std::to_string(size) + " != " +
+                    std::to_string(get<idx>(containers)->size()) + ')'
+                };
+            }
+        });
+
+        auto const& frwd = std::forward_as_tuple(
+                    std::forward<Containers>(containersIn)...);
+        mpl::static_for<sizeof...(Ts)>([&](auto const idx){
+            column<idx>().push_back(get<idx>(frwd));
+        });
+    }
+
+    // template type arguments, appends a single row
+    template <typename... Args,
+              traits::if_equal<sizeof...(Ts), sizeof...(Args)> = true,
+              traits::if_types_equal<Comp<traits::decay_crv_t<Args>...>,
+                                     Comp<traits::convert_to_t<Ts>...>> = true>
+    void push_back(Args&&... argsIn) noexcept(false)
+    {
+        auto const& args = std::forward_as_tuple(std::forward<Args>(argsIn)...);
+        mpl::static_for<sizeof...(Ts)>([&](auto const idx){
+            column<idx>().push_back(get<idx>(args));
+        });
+    }
+
+    /** append **/
+    // frwd arguemnts to push_back
+    template <typename... Args,
+              traits::if_equal<sizeof...(Ts), sizeof...(Args)> = true>
+    void append(Args&&... args) { push_back(std::forward<Args>(args)...); }
+
+    /** columns **/
+    template <size_t tidx>
+    column_type<tidx>& column() { return get<tidx>(m_columns); }
+
+    template <size_t tidx>
+    column_type<tidx> const& column() const { return get<tidx>(m_columns); }
+
+    columns_type& columns() { return m_columns; }
+    columns_type const& columns() const { return m_columns; }
+
+    /** get value **/
+    template <size_t tidx,
+              typename T = traits::convert_to_t<
+                  traits::comp_element_t<tidx, Comp<Ts...>>>>
+    auto getValue(size_type idx) const
+    {
+        return column<tidx>().template value<T>(idx);
+    }
+
+    /** get values **/
+    template <size_t tidx, typename Container =
+                  Vector<traits::convert_to_t<
+                         traits::comp_element_t<tidx, Comp<Ts...>>>>>
+    auto getValues() const
+    {
+        return column<tidx>().template values<Container>();
+    }
+
+    /** compound type names **/
+    // access names used when generating a compound type
+    compound_names const& typeNames() const
+    {
+        return m_typeNames;
+    }
+
+    // set compound type names
+    void setTypeNames(compound_names names)
+    {
+        m_typeNames = std::move(names);
+    }
+
+    // set compound type names using datatype
+    void setTypeNames(DataType const& dtype)
+    {
+        m_typeNames = getTypeNames<sizeof...(Ts)>(dtype);
+    }
+
+    /**
+     * @brief Name of the compound member. Returns the default name if no
+     * name was set.
+     * @param tidx Member index
+     * @return Member name
+     */
+    String memberName(size_t tidx) const
+    {
+        assert(tidx < sizeof...(Ts));
+        if (m_typeNames[tidx].isEmpty())
+        {
+            // same as default names of compound types
+            return String{"type_"} +
+                   String::number(static_cast<qulonglong>(tidx));
+        }
+        return m_typeNames[tidx];
+    }
+
+    /** dataspace  **/
+    DataSpace dataSpace() const
+    {
+        return DataSpace::linear(size());
+    }
+
+    /** datatype **/
+    // same as the datatype of the equivalent CompData
+    DataType dataType() const noexcept(false)
+    {
+        compound_names names;
+        for (size_t i = 0; i < sizeof...(Ts); ++i)
+        {
+            names[i] = memberName(i);
+        }
+        return GenH5::dataType<Comp<Ts...>>(std::move(names));
+    }
+
+    /**
+     * @brief Whether all columns have the same number of elements.
+     * @return is consistent
+     */
+    bool isConsistent() const
+    {
+        bool consistent = true;
+        mpl::static_for<sizeof...(Ts)>([&](auto const idx){
+            consistent &= column<idx>().size() == size();
+        });
+        return consistent;
+    }
+
+    /** STL **/
+    void clear()
+    {
+        mpl::static_for<sizeof...(Ts)>([&](auto const idx){
+            column<idx>().clear();
+        });
+    }
+
+    void reserve(size_type len)
+    {
+        mpl::static_for<sizeof...(Ts)>([&](auto const idx){
+            column<idx>().reserve(len);
+        });
+    }
+
+    void resize(size_type len)
+    {
+        mpl::static_for<sizeof...(Ts)>([&](auto const idx){
+            column<idx>().resize(len);
+        });
+    }
+
+    bool empty() const { return column<0>().empty(); }
+    size_type size() const { return column<0>().size(); }
+
+    /** Qt **/
+    bool isEmpty() const { return empty(); }
+    size_type length() const { return size(); }
+
+private:
+
+    /// columns
+    columns_type m_columns{};
+    /// compound type names
+    compound_names m_typeNames{};
+};
+
+template <typename... Containers>
+inline auto
+makeColumnData(Containers&&... containers)
+{
+    return ColumnData<traits::value_t<Containers>...>{
+        std::forward<Containers>(containers)...
+    };
+}
+
+} // namespace GenH5
+
+#endif // GENH5_DATA_COLUMN_H
@@ -14,10 +14,63 @@
 
 #include "genh5_data/base.h"
 #include "genh5_data/buffer.h"
+#include "genh5_data/mdview.h"
+
+#include <cstring>
 
 namespace GenH5
 {
 
+namespace details
+{
+
+// appends the elements of src to dst using a single memcpy
+template <typename ContainerSrc, typename ContainerDst>
+inline void
+appendTrivially(ContainerSrc const& src, ContainerDst& dst, std::true_type)
+{
+    using size_type = typename ContainerDst::size_type;
+    auto const offset = static_cast<size_type>(dst.size());
+    auto const length = static_cast<size_type>(src.size());
+    if (length == 0) return;
+
+    dst.resize(offset + length);
+    using T = traits::value_t<ContainerSrc>;
+    std::memcpy(dst.data() + offset, src.data(),
+                static_cast<size_t>(length) * sizeof(T));
+}
+
+// appends the elements of src to dst by copying each element
+template <typename ContainerSrc, typename ContainerDst>
+inline void
+appendTrivially(ContainerSrc const& src, ContainerDst& dst, std::false_type)
+{
+    std::copy(std::cbegin(src), std::cend(src), std::back_inserter(dst));
+}
+
+/**
+ * @brief Appends the elements of src to dst without converting each element.
+ * Both containers must share the same trivially copyable value type. Uses a
+ * bulk copy if both containers store their elements contiguously.
+ * @param src Source container
+ * @param dst Destination container
+ */
+template <typename ContainerSrc, typename ContainerDst>
+inline void
+appendTrivially(ContainerSrc const& src, ContainerDst& dst)
+{
+    static_assert(traits::is_trivially_copyable_from<
+                      ContainerSrc, traits::value_t<ContainerDst>>::value,
+                  "Containers must share the same trivially copyable type!");
+
+    using contiguous = std::integral_constant<bool,
+                            traits::is_contiguous<ContainerSrc const>::value &&
+                            traits::is_contiguous<ContainerDst>::value>;
+    appendTrivially(src, dst, contiguous{});
+}
+
+} // namespace details
+
 /** DATA VECTOR **/
 template<typename T>
 class CommonData : public details::AbstractData<T>
@@ -142,14 +195,9 @@ public:
               traits::if_value_types_equal<Container, T> = true>
     void push_back(Container&& c)
     {
-        using GenH5::convert; // ADL
-        auto size = static_cast<size_type>(c.size());
-        m_buffer.reserve(size);
-        m_data.reserve(size);
-        std::transform(std::cbegin(c), std::cend(c),
-                       std::back_inserter(m_data), [&](auto const& value){
-            return convert(value, m_buffer);
-        });
+        // conversion is the identity for trivially copyable types
+        pushBackImpl(c, traits::is_trivially_copyable_from<
+                            Container, value_type>{});
     }
     // frwd ref for template type
     template <typename U, traits::if_types_equal<U, T> = true>
@@ -207,7 +255,7 @@ public:
      * @return value at idx
      */
     template <typename U = T>
-    auto value(Vector<hsize_t> const& idxs) const
+    auto value(Dimensions const& idxs) const
     {
         return value<U>(idx(m_dims, idxs));
     }
@@ -253,16 +301,39 @@ public:
         m_dims.clear();
     }
 
+    /** multidimensional view **/
+    /**
+     * @brief Multidimensional view of fixed rank over the data. The rank must
+     * match the number of dimensions. If no dimensions were set, a rank of
+     * one refers to all elements.
+     * @throws InvalidArgumentError if the rank does not match the dimensions
+     * @param layout Order of the elements in memory
+     * @return Non-owning view, invalidated if the data is resized
+     */
+    template <size_t Rank>
+    MdView<value_type, Rank> view(MdLayout layout = LayoutRight) noexcept(false)
+    {
+        static_assert(std::is_same<conversion_t<T>, T>::value,
+                      "Views require a type that is not converted!");
+        return details::makeMdView<Rank>(data(), size(), m_dims, layout);
+    }
+
+    template <size_t Rank>
+    MdView<value_type const, Rank>
+    view(MdLayout layout = LayoutRight) const noexcept(false)
+    {
+        static_assert(std::is_same<conversion_t<T>, T>::value,
+                      "Views require a type that is not converted!");
+        return details::makeMdView<Rank>(data(), size(), m_dims, layout);
+    }
+
     /** unpack **/
     template <typename Container>
     void unpack(Container& c) const
     {
-        using GenH5::convertTo; // ADL
-        c.reserve(size());
-        std::transform(std::cbegin(m_data), std::cend(m_data),
-                       std::back_inserter(c), [](auto const& value){
-            return convertTo<traits::value_t<Container>>(value);
-        });
+        // conversion is the identity for trivially copyable types
+        unpackImpl(c, traits::is_trivially_copyable_from<
+                          container_type, traits::value_t<Container>>{});
     }
 
     /** resize **/
@@ -359,10 +430,10 @@ public:
     reference operator[](size_type i) { return m_data[i]; }
     const_reference operator[](size_type i) const { return m_data[i]; }
     // ND
-    reference operator[](Vector<hsize_t> const& idxs) {
+    reference operator[](Dimensions const& idxs) {
         return operator[](idx(m_dims, idxs));
     }
-    const_reference operator[](Vector<hsize_t> const& idxs) const {
+    const_reference operator[](Dimensions const& idxs) const {
         return operator[](idx(m_dims, idxs));
     }
 
@@ -425,10 +496,10 @@ public:
         return at(idx(m_dims, {idxA, idxB}));
     }
     // ND
-    reference at(Vector<hsize_t> const& idxs) {
+    reference at(Dimensions const& idxs) {
         return at(idx(m_dims, idxs));
     }
-    const_reference at(Vector<hsize_t> const& idxs) const {
+    const_reference at(Dimensions const& idxs) const {
         return at(idx(m_dims, idxs));
     }
 
@@ -461,6 +532,48 @@ protected:
     Optional<Dimensions> m_dims{};
     /// buffer
     details::StaticBuffer<T> m_buffer{};
+
+private:
+
+    /// push_back implementation converting each element
+    template <typename Container>
+    void pushBackImpl(Container const& c, std::false_type)
+    {
+        using GenH5::convert; // ADL
+        auto size = static_cast<size_type>(c.size());
+        m_buffer.reserve(size);
+        m_data.reserve(m_data.size() + size);
+        std::transform(std::cbegin(c), std::cend(c),
+                       std::back_inserter(m_data), [&](auto const& value){
+            return convert(value, m_buffer);
+        });
+    }
+
+    /// push_back implementation for trivially copyable types
+    template <typename Container>
+    void pushBackImpl(Container const& c, std::true_type)
+    {
+        details::appendTrivially(c, m_data);
+    }
+
+    /// unpack implementation converting each element
+    template <typename Container>
+    void unpackImpl(Container& c, std::false_type) const
+    {
+        using GenH5::convertTo; // ADL
+        c.reserve(size());
+        std::transform(std::cbegin(m_data), std::cend(m_data),
+                       std::back_inserter(c), [](auto const& value){
+            return convertTo<traits::value_t<Container>>(value);
+        });
+    }
+
+    /// unpack implementation for trivially copyable types
+    template <typename Container>
+    void unpackImpl(Container& c, std::true_type) const
+    {
+        details::appendTrivially(m_data, c);
+    }
 };
 
 namespace details
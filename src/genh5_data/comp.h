@@ -192,7 +192,7 @@ public:
     // ND
     template <size_t tidx,
               typename T = traits::comp_element_t<tidx, Comp<Ts...>>>
-    auto getValue(Vector<hsize_t> const& idxs) const
+    auto getValue(Dimensions const& idxs) const
     {
         return getValue<tidx, T>(idx(base_class::m_dims, idxs));
     }
@@ -0,0 +1,357 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#ifndef GENH5_DATA_DICTIONARY_H
+#define GENH5_DATA_DICTIONARY_H
+
+#include "genh5_optional.h"
+#include "genh5_logging.h"
+
+#include "genh5_data/base.h"
+
+#include <QHash>
+
+#include <cstring>
+#include <limits>
+
+namespace GenH5
+{
+
+/**
+ * @brief The DictionaryData class. Dictionary encoded data for string-like
+ * types (i.e. types that are converted to `char*`). Each distinct value is
+ * interned once, the data itself only consists of integer codes referring to
+ * the dictionary. The codes are stored as an HDF5 enum type, which maps each
+ * code to the actual value. Values are only decoded when accessed.
+ *
+ * Since the enum type is stored in the object header of the dataset, the
+ * dictionary should only hold up to a few thousand distinct values. Enum types
+ * may neither be empty nor contain empty names, thus empty values are not
+ * supported and empty data cannot be written.
+ */
+template<typename T, typename Tcode = uint16_t>
+class DictionaryData : public details::AbstractData<T>
+{
+    static_assert(std::is_integral<Tcode>::value &&
+                  std::is_unsigned<Tcode>::value,
+                  "Code type must be an unsigned integer type!");
+    static_assert(std::is_same<conversion_t<T>, char*>::value,
+                  "Dictionary encoding requires a string-like type!");
+
+    using base_class = details::AbstractData<T>;
+
+public:
+
+    DictionaryData() = default;
+
+    using compound_names  = CompoundNames<0>;
+
+    using value_type      = traits::convert_to_t<T>;
+    using code_type       = Tcode;
+    using buffer_type     = buffer_t<T>;
+    using container_type  = Vector<code_type>;
+    using size_type       = typename container_type::size_type;
+
+    // compound type not supported
+    static DataType dataType(compound_names names) = delete;
+
+    /** conversion constructors **/
+    // arbitrary container types
+    template <typename Container,
+              traits::if_value_types_equal<Container, T> = true>
+    // cppcheck-suppress noExplicitConstructor
+    DictionaryData(Container const& c)
+    {
+        push_back(c);
+    }
+    // template type init list
+    // cppcheck-suppress noExplicitConstructor
+    DictionaryData(std::initializer_list<value_type> args)
+    {
+        push_back(args);
+    }
+
+    /** push_back **/
+    // arbitrary container types
+    template <typename Container,
+              traits::if_value_types_equal<Container, T> = true>
+    void push_back(Container const& c)
+    {
+        m_codes.reserve(m_codes.size() + static_cast<size_type>(c.size()));
+        for (auto const& value : c)
+        {
+            m_codes.push_back(intern(value));
+        }
+    }
+    // template type init list
+    void push_back(std::initializer_list<value_type> args)
+    {
+        push_back(Vector<value_type>(args));
+    }
+    // template type
+    void push_back(value_type const& value)
+    {
+        m_codes.push_back(intern(value));
+    }
+
+    /** append **/
+    // frwd arguments to push_back
+    template <typename U>
+    void append(U&& arg) { push_back(std::forward<U>(arg)); }
+
+    /**
+     * @brief Returns the code of the value. Adds the value to the dictionary
+     * if it does not exist yet.
+     * @param value Value to intern
+     * @return Code of value
+     */
+    code_type intern(value_type const& value) noexcept(false)
+    {
+        using GenH5::convert; // ADL
+        m_buffer.clear();
+        char const* encoded = convert(value, m_buffer);
+        auto length = static_cast<int>(std::strlen(encoded));
+
+        if (length == 0)
+        {
+            throw InvalidArgumentError{
+                GENH5_MAKE_EXECEPTION_STR()
+                "Empty values cannot be dictionary encoded"
+            };
+        }
+
+        // lookup without copying the encoded value
+        auto iter = m_lookup.constFind(String::fromRawData(encoded, length));
+        if (iter != m_lookup.cend())
+        {
+            return *iter;
+        }
+
+        if (static_cast<qulonglong>(m_names.size()) >
+            std::numeric_limits<code_type>::max())
+        {
+            throw InvalidArgumentError{
+                GENH5_MAKE_EXECEPTION_STR()
+                "Dictionary exceeds the number of codes representable by "
+                "the code type (" + std::to_string(m_names.size()) + ')'
+            };
+        }
+
+        auto code = static_cast<code_type>(m_names.size());
+        m_names.push_back(String{encoded, length});
+        m_lookup.insert(m_names.back(), code);
+        return code;
+    }
+
+    /**
+     * @brief Returns the code of the value. Can be used to filter the data
+     * by comparing codes only.
+     * @param value Value to search for
+     * @return Code of value. -1 if value is not part of the dictionary.
+     */
+    qlonglong codeOf(value_type const& value) const
+    {
+        using GenH5::convert; // ADL
+        buffer_type buffer;
+        char const* encoded = convert(value, buffer);
+        auto iter = m_lookup.constFind(String{encoded});
+        return iter != m_lookup.cend() ? static_cast<qlonglong>(*iter) : -1;
+    }
+
+    /** codes **/
+    code_type code(size_type idx) const
+    {
+        assert(idx < size());
+        return m_codes[idx];
+    }
+
+    container_type const& codes() const { return m_codes; }
+
+    /** dictionary **/
+    // decoded dictionary entries, the index corresponds to the code
+    template <typename Container = Vector<value_type>>
+    auto dictionary() const
+    {
+        using GenH5::convertTo; // ADL
+        Container c;
+        c.reserve(m_names.size());
+        std::transform(std::cbegin(m_names), std::cend(m_names),
+                       std::back_inserter(c), [](String const& name){
+            return convertTo<traits::value_t<Container>>(name.constData());
+        });
+        return c;
+    }
+
+    // number of distinct values
+    size_type dictionarySize() const { return m_names.size(); }
+
+    /**
+     * @brief Getter for value at idx. Decodes the value.
+     * @param idx index
+     * @return value at idx
+     */
+    template <typename U = value_type>
+    auto value(size_type idx) const
+    {
+        using GenH5::convertTo; // ADL
+        return convertTo<U>(m_names[code(idx)].constData());
+    }
+
+    /** values **/
+    // decodes each dictionary entry only once
+    template <typename Container = Vector<value_type>>
+    auto values() const
+    {
+        auto const dict = dictionary<Vector<traits::value_t<Container>>>();
+        Container c;
+        c.reserve(size());
+        std::transform(std::cbegin(m_codes), std::cend(m_codes),
+                       std::back_inserter(c), [&](code_type code){
+            return dict[code];
+        });
+        return c;
+    }
+
+    /** dataspace  **/
+    DataSpace dataSpace() const override
+    {
+        return m_dims.isDefault() ? DataSpace::linear(size()) :
+                                    DataSpace{m_dims};
+    }
+
+    /** datatype **/
+    // enum type mapping each code to its value
+    DataType dataType() const noexcept(false) override
+    {
+        EnumMembers members;
+        members.reserve(m_names.size());
+        for (size_type i = 0; i < m_names.size(); ++i)
+        {
+            members.append({m_names[i], static_cast<qlonglong>(i)});
+        }
+        return DataType::enumeration(GenH5::dataType<code_type>(), members);
+    }
+
+    /** dimensions **/
+    Dimensions const& dimensions() const
+    {
+        return m_dims;
+    }
+
+    void setDimensions(Dimensions dims) noexcept(false)
+    {
+        if (prod<size_type>(dims) > size())
+        {
+            throw InvalidArgumentError{
+                GENH5_MAKE_EXECEPTION_STR()
+                "Dimension size does not match data size (" +
+                std::to_string(prod<size_type>(dims)) + " vs. " +
+                std::to_string(size()) + ')'
+            };
+        }
+        m_dims = std::move(dims);
+    }
+
+    void clearDimensions()
+    {
+        m_dims.clear();
+    }
+
+    /** resize **/
+    bool resize(DataSpace const& dspace, DataType const& dtype) override
+    {
+        if (!dtype.isEnum())
+        {
+            log::ErrStream()
+                    << GENH5_MAKE_EXECEPTION_STR()
+                       "Dictionary data requires an enum type!";
+            return false;
+        }
+
+        // adopt the dictionary of the enum type. Codes are mapped by name
+        // when reading, thus the values of the enum type are irrelevant
+        auto const members = dtype.enumMembers();
+        if (static_cast<qulonglong>(members.size()) >
+            static_cast<qulonglong>(std::numeric_limits<code_type>::max()) + 1)
+        {
+            log::ErrStream()
+                    << GENH5_MAKE_EXECEPTION_STR()
+                       "Dictionary exceeds the number of codes representable "
+                       "by the code type (" << members.size() << ')';
+            return false;
+        }
+
+        m_names.clear();
+        m_lookup.clear();
+        m_names.reserve(members.size());
+        for (auto const& member : members)
+        {
+            m_lookup.insert(member.name, static_cast<code_type>(m_names.size()));
+            m_names.push_back(member.name);
+        }
+
+        auto selection = static_cast<size_type>(dspace.selectionSize());
+        m_codes.resize(selection);
+
+        // set data dimensions from dataspace
+        if (dspace.size() == selection)
+        {
+            setDimensions(dspace.dimensions());
+        }
+
+        return true;
+    }
+
+    // pointer for reading
+    void* dataReadPtr() override { return m_codes.data(); }
+
+    // pointer for writing
+    void const* dataWritePtr() const override { return m_codes.data(); }
+
+    /** STL **/
+    void clear()
+    {
+        m_codes.clear();
+        m_names.clear();
+        m_lookup.clear();
+        m_dims.clear();
+    }
+    bool empty() const { return m_codes.empty(); }
+    size_type size() const override { return m_codes.size(); }
+
+    void reserve(size_type len) { return m_codes.reserve(len); }
+
+    /** Qt **/
+    bool isEmpty() const { return empty(); }
+    size_type length() const { return size(); }
+
+private:
+
+    /// codes referring to the dictionary
+    container_type m_codes{};
+    /// encoded dictionary entries, the index corresponds to the code
+    Vector<String> m_names{};
+    /// lookup for interning values
+    QHash<String, code_type> m_lookup{};
+    /// data dimensions
+    Optional<Dimensions> m_dims{};
+    /// buffer for encoding values
+    buffer_type m_buffer{};
+};
+
+template <typename Container>
+inline auto
+makeDictionaryData(Container const& container)
+{
+    return DictionaryData<traits::value_t<Container>>{container};
+}
+
+} // namespace GenH5
+
+#endif // GENH5_DATA_DICTIONARY_H
@@ -0,0 +1,269 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#ifndef GENH5_DATA_MDVIEW_H
+#define GENH5_DATA_MDVIEW_H
+
+#include "genh5_typedefs.h"
+#include "genh5_optional.h"
+#include "genh5_exception.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <string>
+
+namespace GenH5
+{
+
+/**
+ * @brief The MdLayout enum. Order of the elements in memory.
+ */
+enum MdLayout
+{
+    /// row major (C order), the last index is contiguous. Same as HDF5.
+    LayoutRight = 0,
+    /// column major (Fortran order), the first index is contiguous.
+    LayoutLeft = 1
+};
+
+/**
+ * @brief The MdView class. Non-owning view with a fixed rank over
+ * multidimensional data (similar to `std::mdspan`). Extents and strides are
+ * computed once, thus accessing an element is a dot product of the indices
+ * and the strides. Slicing a view yields a view of lower rank over the same
+ * memory. The memory must outlive the view.
+ */
+template <typename T, size_t Rank>
+class MdView
+{
+    static_assert(Rank > 0, "MdView requires a rank of at least one");
+
+public:
+
+    using value_type   = std::remove_const_t<T>;
+    using element_type = T;
+    using pointer      = T*;
+    using reference    = T&;
+    using extents_type = std::array<hsize_t, Rank>;
+
+    MdView() = default;
+
+    /**
+     * @brief Constructs a view over `data` with the given extents. The
+     * strides are computed from `layout`.
+     * @param data Pointer to the first element
+     * @param extents Extent of each dimension
+     * @param layout Order of the elements in memory
+     */
+    MdView(pointer data, extents_type extents, MdLayout layout = LayoutRight) :
+        m_data{data}, m_extents{extents}
+    {
+        hsize_t stride = 1;
+        for (size_t i = 0; i < Rank; ++i)
+        {
+            size_t dim = layout == LayoutRight ? Rank - 1 - i : i;
+            m_strides[dim] = stride;
+            stride *= m_extents[dim];
+        }
+        assert(m_data || stride == 0);
+    }
+
+    /**
+     * @brief Constructs a view with explicit strides (e.g. a strided slice).
+     * @param data Pointer to the first element
+     * @param extents Extent of each dimension
+     * @param strides Stride of each dimension in elements
+     */
+    MdView(pointer data, extents_type extents, extents_type strides) :
+        m_data{data}, m_extents{extents}, m_strides{strides}
+    { }
+
+    // views of non-const elements can be converted to const views
+    template <typename U,
+              std::enable_if_t<std::is_same<U const, T>::value &&
+                               !std::is_same<U, T>::value, bool> = true>
+    // cppcheck-suppress noExplicitConstructor
+    MdView(MdView<U, Rank> const& other) :
+        m_data{other.data()}, m_extents{other.extents()},
+        m_strides{other.strides()}
+    { }
+
+    /**
+     * @brief Constructs a view over `data` using runtime dimensions.
+     * @throws InvalidArgumentError if the number of dimensions does not match
+     * the rank
+     * @param data Pointer to the first element
+     * @param dims Dimensions
+     * @param layout Order of the elements in memory
+     * @return View
+     */
+    static MdView fromDimensions(pointer data, Dimensions const& dims,
+                                 MdLayout layout = LayoutRight) noexcept(false)
+    {
+        return MdView{data, toExtents(dims), layout};
+    }
+
+    static constexpr size_t rank() noexcept { return Rank; }
+
+    /** extents **/
+    hsize_t extent(size_t dim) const
+    {
+        assert(dim < Rank);
+        return m_extents[dim];
+    }
+    extents_type const& extents() const noexcept { return m_extents; }
+
+    /** strides **/
+    hsize_t stride(size_t dim) const
+    {
+        assert(dim < Rank);
+        return m_strides[dim];
+    }
+    extents_type const& strides() const noexcept { return m_strides; }
+
+    /**
+     * @brief Number of elements in the view
+     * @return size
+     */
+    hsize_t size() const noexcept
+    {
+        hsize_t size = 1;
+        for (hsize_t extent : m_extents) size *= extent;
+        return size;
+    }
+    bool empty() const noexcept { return size() == 0; }
+
+    /**
+     * @brief Whether the elements are stored contiguously in row major or
+     * column major order.
+     * @return is contiguous
+     */
+    bool isContiguous() const noexcept
+    {
+        return isContiguous(LayoutRight) || isContiguous(LayoutLeft);
+    }
+
+    pointer data() const noexcept { return m_data; }
+
+    /** element access **/
+    template <typename... Idxs,
+              std::enable_if_t<sizeof...(Idxs) == Rank, bool> = true>
+    reference operator()(Idxs... idxs) const
+    {
+        extents_type const idx{static_cast<hsize_t>(idxs)...};
+        return m_data[offset(idx)];
+    }
+
+    reference operator[](extents_type const& idx) const
+    {
+        return m_data[offset(idx)];
+    }
+
+    // 1D
+    template <size_t R = Rank, std::enable_if_t<R == 1, bool> = true>
+    reference operator[](hsize_t idx) const
+    {
+        assert(idx < m_extents[0]);
+        return m_data[idx * m_strides[0]];
+    }
+
+    /**
+     * @brief Slices the view at index `idx` of the first dimension. E.g.
+     * the slice of a matrix is a row in row major order.
+     * @param idx Index of the first dimension
+     * @return View with a rank of one less
+     */
+    template <size_t R = Rank, std::enable_if_t<(R > 1), bool> = true>
+    MdView<T, Rank - 1> slice(hsize_t idx) const
+    {
+        assert(idx < m_extents[0]);
+
+        std::array<hsize_t, Rank - 1> extents;
+        std::array<hsize_t, Rank - 1> strides;
+        std::copy(m_extents.begin() + 1, m_extents.end(), extents.begin());
+        std::copy(m_strides.begin() + 1, m_strides.end(), strides.begin());
+
+        return {m_data + idx * m_strides[0], extents, strides};
+    }
+
+private:
+
+    /// pointer to the first element
+    pointer m_data{};
+    /// extent of each dimension
+    extents_type m_extents{};
+    /// stride of each dimension in elements
+    extents_type m_strides{};
+
+    hsize_t offset(extents_type const& idx) const
+    {
+        hsize_t offset = 0;
+        for (size_t i = 0; i < Rank; ++i)
+        {
+            assert(idx[i] < m_extents[i]);
+            offset += idx[i] * m_strides[i];
+        }
+        return offset;
+    }
+
+    bool isContiguous(MdLayout layout) const noexcept
+    {
+        hsize_t stride = 1;
+        for (size_t i = 0; i < Rank; ++i)
+        {
+            size_t dim = layout == LayoutRight ? Rank - 1 - i : i;
+            if (m_extents[dim] > 1 && m_strides[dim] != stride) return false;
+            stride *= m_extents[dim];
+        }
+        return true;
+    }
+
+    static extents_type toExtents(Dimensions const& dims) noexcept(false)
+    {
+        if (static_cast<size_t>(dims.size()) != Rank)
+        {
+            throw InvalidArgumentError{
+                GENH5_MAKE_EXECEPTION_STR() "Number of dimensions does not "
+                "match the rank of the view (" + std::to_string(dims.size()) +
+                " != " + std::to_string(Rank) + ')'
+            };
+        }
+
+        extents_type extents;
+        std::copy(dims.cbegin(), dims.cend(), extents.begin());
+        return extents;
+    }
+};
+
+namespace details
+{
+
+/**
+ * @brief Creates a view over data of `size` elements. If no dimensions were
+ * set, a rank of one refers to all elements.
+ * @throws InvalidArgumentError if the rank does not match the dimensions
+ */
+template <size_t Rank, typename T>
+inline MdView<T, Rank>
+makeMdView(T* data, hsize_t size, Optional<Dimensions> const& dims,
+           MdLayout layout) noexcept(false)
+{
+    if (dims.isDefault() && Rank == 1)
+    {
+        return MdView<T, Rank>::fromDimensions(data, Dimensions{size}, layout);
+    }
+    return MdView<T, Rank>::fromDimensions(data, dims.value(), layout);
+}
+
+} // namespace details
+
+} // namespace GenH5
+
+#endif // GENH5_DATA_MDVIEW_H
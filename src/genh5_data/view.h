@@ -0,0 +1,274 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#ifndef GENH5_DATA_VIEW_H
+#define GENH5_DATA_VIEW_H
+
+#include "genh5_optional.h"
+#include "genh5_logging.h"
+
+#include "genh5_data/base.h"
+#include "genh5_data/mdview.h"
+
+namespace GenH5
+{
+
+namespace details
+{
+
+/**
+ * @brief The AbstractDataView class. Base class for non-owning data views over
+ * contiguous memory of the caller (e.g. std::vector, a pool allocated buffer
+ * or a matrix). Data is read and written directly from and to this memory,
+ * thus T must not require a conversion.
+ */
+template<typename T, typename Tpointee>
+class AbstractDataView : public AbstractData<T>
+{
+    static_assert(std::is_same<conversion_t<T>, T>::value,
+                  "Data views require a type that is not converted!");
+
+    using base_class = AbstractData<T>;
+
+public:
+
+    using value_type      = T;
+    using size_type       = typename base_class::size_type;
+    using pointer         = Tpointee*;
+    using reference       = Tpointee&;
+    using iterator        = Tpointee*;
+    using const_iterator  = T const*;
+
+    AbstractDataView() = default;
+
+    AbstractDataView(pointer data, size_type size) :
+        m_data{data}, m_size{size}
+    {
+        assert(m_data || m_size == 0);
+    }
+
+    AbstractDataView(pointer data, Dimensions dims) noexcept(false) :
+        AbstractDataView(data, prod<size_type>(dims))
+    {
+        m_dims = std::move(dims);
+    }
+
+    /** dataspace  **/
+    DataSpace dataSpace() const override
+    {
+        return m_dims.isDefault() ? DataSpace::linear(size()) :
+                                    DataSpace{m_dims};
+    }
+
+    /** dimensions **/
+    Dimensions const& dimensions() const
+    {
+        return m_dims;
+    }
+
+    void setDimensions(Dimensions dims) noexcept(false)
+    {
+        if (prod<size_type>(dims) > size())
+        {
+            throw InvalidArgumentError{
+                GENH5_MAKE_EXECEPTION_STR()
+                "Dimension size does not match data size (" +
+                std::to_string(prod<size_type>(dims)) + " vs. " +
+                std::to_string(size()) + ')'
+            };
+        }
+        m_dims = std::move(dims);
+    }
+
+    void clearDimensions()
+    {
+        m_dims.clear();
+    }
+
+    /** multidimensional view **/
+    /**
+     * @brief Multidimensional view of fixed rank over the data. The rank must
+     * match the number of dimensions. If no dimensions were set, a rank of
+     * one refers to all elements.
+     * @throws InvalidArgumentError if the rank does not match the dimensions
+     * @param layout Order of the elements in memory
+     * @return Non-owning view
+     */
+    template <size_t Rank>
+    MdView<Tpointee, Rank> view(MdLayout layout = LayoutRight) const noexcept(false)
+    {
+        return details::makeMdView<Rank>(m_data, size(), m_dims, layout);
+    }
+
+    // pointer for writing
+    void const* dataWritePtr() const override { return m_data; }
+
+    /** index operator **/
+    reference operator[](size_type i) const
+    {
+        assert(i < size());
+        return m_data[i];
+    }
+
+    /** STL **/
+    bool empty() const { return m_size == 0; }
+    size_type size() const override { return m_size; }
+
+    pointer data() const { return m_data; }
+
+    iterator begin() const { return m_data; }
+    iterator end() const { return m_data + m_size; }
+    const_iterator cbegin() const { return m_data; }
+    const_iterator cend() const { return m_data + m_size; }
+
+    /** Qt **/
+    bool isEmpty() const { return empty(); }
+    size_type length() const { return size(); }
+
+    T const* constData() const { return m_data; }
+
+protected:
+
+    /// memory of the caller
+    pointer m_data{};
+    /// number of elements
+    size_type m_size{};
+    /// data dimensions
+    Optional<Dimensions> m_dims{};
+};
+
+} // namespace details
+
+/**
+ * @brief The DataView class. Read-only, non-owning view over contiguous
+ * memory. Can be used to write data directly from the memory of the caller.
+ * The memory must outlive the view. Cannot be used for reading.
+ */
+template<typename T>
+class DataView : public details::AbstractDataView<T, T const>
+{
+    using base_class = details::AbstractDataView<T, T const>;
+
+public:
+
+    using size_type = typename base_class::size_type;
+
+    DataView() = default;
+
+    DataView(T const* data, size_type size) :
+        base_class{data, size}
+    { }
+
+    DataView(T const* data, Dimensions dims) noexcept(false) :
+        base_class{data, std::move(dims)}
+    { }
+
+    // arbitrary contiguous container types
+    template <typename Container,
+              traits::if_value_types_equal<Container, T> = true,
+              std::enable_if_t<traits::is_contiguous<Container const>::value &&
+                               !std::is_same<Container, DataView>::value,
+                               bool> = true>
+    // cppcheck-suppress noExplicitConstructor
+    DataView(Container const& c) :
+        base_class{c.data(), static_cast<size_type>(c.size())}
+    { }
+
+    /** resize **/
+    // the memory of a read-only view cannot be written to
+    bool resize(DataSpace const& /*dspace*/,
+                DataType const& /*dtype*/) override
+    {
+        log::ErrStream()
+                << GENH5_MAKE_EXECEPTION_STR()
+                   "Cannot read into a read-only data view!";
+        return false;
+    }
+
+    // pointer for reading
+    void* dataReadPtr() override { return nullptr; }
+};
+
+/**
+ * @brief The MutableDataView class. Non-owning view over contiguous memory.
+ * Can be used to read and write data directly from and to the memory of the
+ * caller. The memory must outlive the view. Since the memory cannot be grown,
+ * reading fails if it holds too few elements.
+ */
+template<typename T>
+class MutableDataView : public details::AbstractDataView<T, T>
+{
+    using base_class = details::AbstractDataView<T, T>;
+
+public:
+
+    using size_type = typename base_class::size_type;
+
+    MutableDataView() = default;
+
+    MutableDataView(T* data, size_type size) :
+        base_class{data, size}
+    { }
+
+    MutableDataView(T* data, Dimensions dims) noexcept(false) :
+        base_class{data, std::move(dims)}
+    { }
+
+    // arbitrary contiguous container types
+    template <typename Container,
+              traits::if_value_types_equal<Container, T> = true,
+              std::enable_if_t<traits::is_contiguous<Container>::value &&
+                               !std::is_const<Container>::value &&
+                               !std::is_same<Container, MutableDataView>::value,
+                               bool> = true>
+    // cppcheck-suppress noExplicitConstructor
+    MutableDataView(Container& c) :
+        base_class{c.data(), static_cast<size_type>(c.size())}
+    { }
+
+    /** resize **/
+    // memory cannot be grown, only checks if enough elements are available
+    bool resize(DataSpace const& dspace, DataType const& /*dtype*/) override
+    {
+        auto selection = static_cast<size_type>(dspace.selectionSize());
+        if (selection > this->size())
+        {
+            return false;
+        }
+
+        // set data dimensions from dataspace
+        if (dspace.size() == selection)
+        {
+            this->m_dims = dspace.dimensions();
+        }
+
+        return true;
+    }
+
+    // pointer for reading
+    void* dataReadPtr() override { return this->m_data; }
+};
+
+template <typename Container>
+inline auto
+makeDataView(Container const& container)
+{
+    return DataView<traits::value_t<Container>>{container};
+}
+
+template <typename Container>
+inline auto
+makeMutableDataView(Container& container)
+{
+    return MutableDataView<traits::value_t<Container>>{container};
+}
+
+} // namespace GenH5
+
+#endif // GENH5_DATA_VIEW_H
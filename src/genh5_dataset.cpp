@@ -11,6 +11,7 @@
 #include "genh5_private.h"
 #include "genh5_node.h"
 #include "genh5_file.h"
+#include "genh5_fileindex.h"
 #include "genh5_hooks.h"
 
 #include "H5Dpublic.h"
@@ -18,17 +19,22 @@
 
 #include <QDebug>
 
+#include <cassert>
+#include <cstring>
+#include <vector>
+
 namespace
 {
 
-inline bool writeImpl(GenH5::DataSet const& dset,
+inline bool writeImpl(GenH5::DataSetRef dset,
                       void const* data,
                       GenH5::DataSpace const& fileSpace,
                       GenH5::DataSpace const& memSpace,
                       GenH5::DataType const& dtype)
 {
-    GenH5::File file = dset.file();
-    if (auto hook = findHook(file, GenH5::PreDataSetWriteHook)) {
+    using GenH5::details::findObjectHook;
+
+    if (auto hook = findObjectHook(dset.id(), GenH5::PreDataSetWriteHook)) {
         GenH5::DataSetWriteHookContext context{data, &fileSpace, &memSpace, &dtype};
         GenH5::HookReturnValue rvalue = hook(dset.id(), &context);
         if (rvalue != GenH5::HookContinue)
@@ -39,7 +45,7 @@ inline bool writeImpl(GenH5::DataSet const& dset,
 
     herr_t err = H5Dwrite(dset.id(), dtype.id(), memSpace.id(), fileSpace.id(), H5P_DEFAULT, data);
 
-    if (auto hook = findHook(file, GenH5::PostDataSetWriteHook)) {
+    if (auto hook = findObjectHook(dset.id(), GenH5::PostDataSetWriteHook)) {
         GenH5::DataSetWriteHookContext context{data, &fileSpace, &memSpace, &dtype};
         GenH5::HookReturnValue rvalue = hook(dset.id(), &context);
         if (rvalue != GenH5::HookContinue)
@@ -51,21 +57,22 @@ inline bool writeImpl(GenH5::DataSet const& dset,
     return err >= 0;
 }
 
-inline bool readImpl(GenH5::DataSet const& dset,
+inline bool readImpl(GenH5::DataSetRef dset,
                      void* data,
                      GenH5::DataSpace const& fileSpace,
                      GenH5::DataSpace const& memSpace,
                      GenH5::DataType const& dtype)
 {
-    GenH5::File file = dset.file();
-    if (auto hook = findHook(file, GenH5::PreDataSetReadHook)) {
+    using GenH5::details::findObjectHook;
+
+    if (auto hook = findObjectHook(dset.id(), GenH5::PreDataSetReadHook)) {
         GenH5::DataSetReadHookContext context{data, &fileSpace, &memSpace, &dtype};
         hook(dset.id(), &context);
     }
 
     herr_t err = H5Dread(dset.id(), dtype.id(), memSpace.id(), fileSpace.id(), H5P_DEFAULT, data);
 
-    if (auto hook = findHook(file, GenH5::PostDataSetReadHook)) {
+    if (auto hook = findObjectHook(dset.id(), GenH5::PostDataSetReadHook)) {
         GenH5::DataSetReadHookContext context{data, &fileSpace, &memSpace, &dtype};
         hook(dset.id(), &context);
     }
@@ -194,6 +201,125 @@ GenH5::DataSet::read(void* data,
     return readImpl(*this, data, fileSpace, memSpace, dtype);
 }
 
+bool
+GenH5::DataSet::readDirect(void* data,
+                           DataSpace const& fileSpace,
+                           DataSpace const& memSpace,
+                           DataType const& dtype) const noexcept(false)
+{
+    return readImpl(*this, data, fileSpace, memSpace, dtype);
+}
+
+GenH5::DataType
+GenH5::DataSet::memberDataType(String const& name) const noexcept(false)
+{
+    for (auto const& member : dataType().compoundMembers())
+    {
+        if (member.name == name)
+        {
+            return member.type;
+        }
+    }
+    return {};
+}
+
+bool
+GenH5::DataSet::readMemberImpl(String const& name,
+                               void* data,
+                               DataType const& dtype) const noexcept(false)
+{
+    if (!memberDataType(name).isValid())
+    {
+        log::ErrStream()
+                << GENH5_MAKE_EXECEPTION_STR() "Reading member '" << name
+                << "' of dataset '" << path() << "' failled (no such member)";
+        return false;
+    }
+
+    // memory type consisting of the requested member only. Members are
+    // matched by name, thus all other members are skipped
+    auto memType = DataType::compound(dtype.size(), {{name, 0, dtype}});
+
+    return read(data, memType);
+}
+
+bool
+GenH5::DataSet::writeMemberImpl(String const& name,
+                                void const* data,
+                                DataType const& dtype) const noexcept(false)
+{
+    if (!memberDataType(name).isValid())
+    {
+        log::ErrStream()
+                << GENH5_MAKE_EXECEPTION_STR() "Writing member '" << name
+                << "' of dataset '" << path() << "' failled (no such member)";
+        return false;
+    }
+
+    // memory type consisting of the member only. All other members are
+    // not part of the memory type and thus preserved
+    auto memType = DataType::compound(dtype.size(), {{name, 0, dtype}});
+
+    return write(data, memType);
+}
+
+bool
+GenH5::DataSet::writeColumnsImpl(CompoundMembers members,
+                                 Vector<void const*> const& columns,
+                                 size_t size) const noexcept(false)
+{
+    assert(members.size() == columns.size());
+
+    auto selected = dataSpace().selectionSize();
+
+    if (size < selected)
+    {
+        log::ErrStream()
+                << GENH5_MAKE_EXECEPTION_STR()
+                   "Writing data failed! (too few data elements: "
+                << size << " vs. " << selected << " selected elements)";
+        return false;
+    }
+
+    // memory type consisting of the columns only (packed). All other
+    // members are not part of the memory type and thus preserved
+    size_t rowSize = 0;
+    for (auto& member : members)
+    {
+        if (!memberDataType(member.name).isValid())
+        {
+            log::ErrStream()
+                    << GENH5_MAKE_EXECEPTION_STR() "Writing member '"
+                    << member.name << "' of dataset '" << path()
+                    << "' failled (no such member)";
+            return false;
+        }
+        member.offset = rowSize;
+        rowSize += member.type.size();
+    }
+
+    auto memType = DataType::compound(rowSize, members);
+
+    // interleave columns
+    std::vector<char> buffer(selected * rowSize);
+    for (int i = 0; i < members.size(); ++i)
+    {
+        auto const* src = static_cast<char const*>(columns[i]);
+        size_t const offset = members[i].offset;
+        size_t const memberSize = members[i].type.size();
+
+        char* dst = buffer.data() + offset;
+        for (size_t row = 0; row < selected; ++row)
+        {
+            std::memcpy(dst, src, memberSize);
+            dst += rowSize;
+            src += memberSize;
+        }
+    }
+
+    return write(buffer.data(), memType);
+}
+
 void
 GenH5::DataSet::deleteLink() noexcept(false)
 {
@@ -214,14 +340,19 @@ GenH5::DataSet::deleteLink() noexcept(false)
         resize(dims);
     }
 
+    auto f = file();
+    auto p = path();
+
     // returns error type
-    if (H5Ldelete(file().id(), path().constData(), H5P_DEFAULT) < 0)
+    if (H5Ldelete(f.id(), p.constData(), H5P_DEFAULT) < 0)
     {
         throw LocationException{
             GENH5_MAKE_EXECEPTION_STR() "Deleting dataset '" +
-            path().toStdString() + "' failed"
+            p.toStdString() + "' failed"
         };
     }
+    details::removeCachedHandles(f, p);
+    details::fileIndexRemove(f, std::move(p));
     close();
 }
 
@@ -17,6 +17,8 @@
 namespace GenH5
 {
 
+namespace details { class ReadContextBase; }
+
 /**
  * @brief The DataSet class
  */
@@ -126,6 +128,69 @@ public:
               DataSpace const& fileSpace,
               Optional<DataType> dtype = {}) noexcept(false);
 
+    /**
+     * @brief Reads a single member of this compound dataset directly into
+     * data (column projection). Only the member specified is converted.
+     * Types that require a conversion (e.g. strings) are read into a
+     * temporary buffer first.
+     * @param name Name of the compound member
+     * @param data buffer to read
+     * @return sucess
+     */
+    template<typename T>
+    bool readMember(String const& name,
+                    Vector<T>& data) const noexcept(false);
+
+    template<typename T>
+    bool readMember(String const& name,
+                    details::AbstractData<T>& data) const noexcept(false);
+
+    /**
+     * @brief Reads a subset of the members of this compound dataset (column
+     * projection). The memory type only consists of the members specified,
+     * all other members are skipped.
+     * @param names Names of the compound members to read
+     * @return Data read
+     */
+    template<typename T1, typename T2, typename... Ts>
+    Data<T1, T2, Ts...> readMembers(CompoundNames<sizeof...(Ts) + 2> names
+                                    ) const noexcept(false);
+
+    /**
+     * @brief Writes data to a single member of this compound dataset. All
+     * other members are preserved.
+     * @param name Name of the compound member
+     * @param data buffer to write
+     * @return sucess
+     */
+    template<typename T>
+    bool writeMember(String const& name,
+                     Vector<T> const& data) const noexcept(false);
+
+    template<typename T>
+    bool writeMember(String const& name,
+                     details::AbstractData<T> const& data) const noexcept(false);
+
+    /**
+     * @brief Writes column data to this compound dataset. The columns are
+     * interleaved into a temporary buffer (one row per element) and written
+     * at once, thus the dataset is only accessed once. Compound members are
+     * matched by name, all other members are preserved.
+     * @param data Data to write
+     * @return sucess
+     */
+    template<typename... Ts>
+    bool write(ColumnData<Ts...> const& data) const noexcept(false);
+
+    /**
+     * @brief Reads this compound dataset into column data. Each column is
+     * read separately, compound members are matched by name.
+     * @param data Data to read
+     * @return sucess
+     */
+    template<typename... Ts>
+    bool read(ColumnData<Ts...>& data) const noexcept(false);
+
     /*
      *  WRITE ATTRIBUTE
      */
@@ -185,12 +250,56 @@ protected:
 
 private:
 
+    /// datatype of the compound member. Invalid if member does not exist
+    DataType memberDataType(String const& name) const noexcept(false);
+
+    /// read implementation for a single compound member
+    bool readMemberImpl(String const& name,
+                        void* data,
+                        DataType const& dtype) const noexcept(false);
+
+    /// reads a single compound member into a vector of trivially copyable
+    /// types that are not converted
+    template<typename T>
+    bool readMemberVector(String const& name,
+                          Vector<T>& data,
+                          std::true_type) const noexcept(false);
+
+    /// reads a single compound member into a vector using a conversion
+    /// buffer
+    template<typename T>
+    bool readMemberVector(String const& name,
+                          Vector<T>& data,
+                          std::false_type) const noexcept(false);
+
+    /// read implementation without validating the arguments or accessing
+    /// the dataspace and datatype of this dataset
+    bool readDirect(void* data,
+                    DataSpace const& fileSpace,
+                    DataSpace const& memSpace,
+                    DataType const& dtype) const noexcept(false);
+
+    /// write implementation for a single compound member
+    bool writeMemberImpl(String const& name,
+                         void const* data,
+                         DataType const& dtype) const noexcept(false);
+
+    /// write implementation for multiple compound members. `members` holds
+    /// the name and datatype of each column, the offsets are ignored
+    bool writeColumnsImpl(CompoundMembers members,
+                          Vector<void const*> const& columns,
+                          size_t size) const noexcept(false);
+
     /// dataset id
     IdComponent<IdType::DataSet> m_id;
 
     friend class Reference;
+    friend class details::ReadContextBase;
 };
 
+/// borrowed reference to a dataset
+using DataSetRef = ObjectRef<DataSet>;
+
 template<typename T>
 inline bool
 DataSet::write(Vector<T> const& data,
@@ -287,6 +396,170 @@ DataSet::read(details::AbstractData<T>& data,
                 std::move(dtype));
 }
 
+template<typename T>
+inline bool
+DataSet::readMember(String const& name,
+                    Vector<T>& data) const noexcept(false)
+{
+    using is_direct = std::integral_constant<bool,
+            std::is_same<conversion_t<T>, T>::value &&
+            std::is_trivially_copyable<T>::value>;
+
+    return readMemberVector(name, data, is_direct{});
+}
+
+template<typename T>
+inline bool
+DataSet::readMemberVector(String const& name,
+                          Vector<T>& data,
+                          std::true_type) const noexcept(false)
+{
+    data.resize(dataSpace().selectionSize());
+    return readMemberImpl(name, data.data(), GenH5::dataType<T>());
+}
+
+template<typename T>
+inline bool
+DataSet::readMemberVector(String const& name,
+                          Vector<T>& data,
+                          std::false_type) const noexcept(false)
+{
+    Data<T> buffer;
+    if (!readMember(name, buffer)) return false;
+
+    data = buffer.values();
+    return true;
+}
+
+template<typename T>
+inline bool
+DataSet::readMember(String const& name,
+                    details::AbstractData<T>& data) const noexcept(false)
+{
+    auto dspace = dataSpace();
+    if (!data.resize(dspace, memberDataType(name)))
+    {
+        log::ErrStream()
+                << GENH5_MAKE_EXECEPTION_STR()
+                   "Reading data failed! (data container is too small: "
+                << data.size() << " vs. "
+                << dspace.selectionSize() << " selected elements)";
+        return false;
+    }
+
+    return readMemberImpl(name, data.dataReadPtr(), data.dataType());
+}
+
+template<typename T1, typename T2, typename... Ts>
+inline Data<T1, T2, Ts...>
+DataSet::readMembers(CompoundNames<sizeof...(Ts) + 2> names
+                     ) const noexcept(false)
+{
+    // compound type of data only consists of the members requested
+    Data<T1, T2, Ts...> data;
+    data.setTypeNames(std::move(names));
+
+    for (auto const& name : data.typeNames())
+    {
+        if (!memberDataType(name).isValid())
+        {
+            throw DataSetException{
+                GENH5_MAKE_EXECEPTION_STR() "Failed to read member '" +
+                name.toStdString() + "' of dataset '" +
+                path().toStdString() + "' (member not found)"
+            };
+        }
+    }
+
+    if (!read(data))
+    {
+        throw DataSetException{
+            GENH5_MAKE_EXECEPTION_STR() "Failed to read members of dataset '" +
+            path().toStdString() + '\''
+        };
+    }
+
+    return data;
+}
+
+template<typename T>
+inline bool
+DataSet::writeMember(String const& name,
+                     Vector<T> const& data) const noexcept(false)
+{
+    auto selected = dataSpace().selectionSize();
+
+    if (data.size() < selected)
+    {
+        log::ErrStream()
+                << GENH5_MAKE_EXECEPTION_STR()
+                   "Writing data failed! (too few data elements: "
+                << data.size() << " vs. "
+                << selected << " selected elements)";
+        return false;
+    }
+
+    return writeMemberImpl(name, data.constData(), GenH5::dataType<T>());
+}
+
+template<typename T>
+inline bool
+DataSet::writeMember(String const& name,
+                     details::AbstractData<T> const& data
+                     ) const noexcept(false)
+{
+    auto selected = dataSpace().selectionSize();
+
+    if (data.size() < selected)
+    {
+        log::ErrStream()
+                << GENH5_MAKE_EXECEPTION_STR()
+                   "Writing data failed! (too few data elements: "
+                << data.size() << " vs. "
+                << selected << " selected elements)";
+        return false;
+    }
+
+    return writeMemberImpl(name, data.dataWritePtr(), data.dataType());
+}
+
+template<typename... Ts>
+inline bool
+DataSet::write(ColumnData<Ts...> const& data) const noexcept(false)
+{
+    if (!data.isConsistent())
+    {
+        log::ErrStream()
+                << GENH5_MAKE_EXECEPTION_STR()
+                   "Writing data failed! (columns have different number "
+                   "of elements)";
+        return false;
+    }
+
+    CompoundMembers members;
+    Vector<void const*> columns;
+    mpl::static_for<sizeof...(Ts)>([&](auto const idx){
+        auto const& column = data.template column<idx>();
+        members.push_back({data.memberName(idx), 0, column.dataType()});
+        columns.push_back(column.dataWritePtr());
+    });
+
+    return writeColumnsImpl(std::move(members), columns,
+                            static_cast<size_t>(data.size()));
+}
+
+template<typename... Ts>
+inline bool
+DataSet::read(ColumnData<Ts...>& data) const noexcept(false)
+{
+    bool success = true;
+    mpl::static_for<sizeof...(Ts)>([&](auto const idx){
+        success = success &&
+                  readMember(data.memberName(idx), data.template column<idx>());
+    });
+    return success;
+}
+
 } // namespace GenH5
 
 inline void
@@ -9,14 +9,107 @@
 
 #include "genh5_datasetcproperties.h"
 #include "genh5_dataspace.h"
+#include "genh5_datatype.h"
 #include "genh5_private.h"
 
 #include <H5Ppublic.h>
 #include <H5Zpublic.h>
 
+#include <atomic>
+
 static constexpr int s_cmax = 9u;
 static constexpr int s_cmin = 0u;
 
+/// zstd compression levels
+static constexpr int s_zstdMax = 22;
+static constexpr int s_zstdMin = 1;
+
+/// chunks must be smaller than 4 GiB
+static constexpr size_t s_maxChunkSize = (size_t{1} << 32) - 1;
+/// targeted chunk size, equals the size of the default chunk cache
+static std::atomic<size_t> s_chunkSize{1024 * 1024};
+
+/// compact data must fit into the object header (64 KiB incl. overhead)
+static constexpr size_t s_maxCompactSize = 63 * 1024;
+
+static_assert(GenH5::FilterDeflate == H5Z_FILTER_DEFLATE &&
+              GenH5::FilterShuffle == H5Z_FILTER_SHUFFLE &&
+              GenH5::FilterFletcher32 == H5Z_FILTER_FLETCHER32 &&
+              GenH5::FilterSzip == H5Z_FILTER_SZIP &&
+              GenH5::FilterNBit == H5Z_FILTER_NBIT &&
+              GenH5::FilterScaleOffset == H5Z_FILTER_SCALEOFFSET,
+              "GenH5 and HDF5 filter ids must match");
+
+static_assert(GenH5::ScaleFloatDecimal == H5Z_SO_FLOAT_DSCALE &&
+              GenH5::ScaleInteger == H5Z_SO_INT,
+              "GenH5 and HDF5 scale types must match");
+
+static_assert(GenH5::FillOnAlloc == H5D_FILL_TIME_ALLOC &&
+              GenH5::FillNever == H5D_FILL_TIME_NEVER &&
+              GenH5::FillIfSet == H5D_FILL_TIME_IFSET,
+              "GenH5 and HDF5 fill times must match");
+
+static_assert(GenH5::AllocDefault == H5D_ALLOC_TIME_DEFAULT &&
+              GenH5::AllocEarly == H5D_ALLOC_TIME_EARLY &&
+              GenH5::AllocLate == H5D_ALLOC_TIME_LATE &&
+              GenH5::AllocIncremental == H5D_ALLOC_TIME_INCR,
+              "GenH5 and HDF5 allocation times must match");
+
+static_assert(GenH5::CompactLayout == H5D_COMPACT &&
+              GenH5::ContiguousLayout == H5D_CONTIGUOUS &&
+              GenH5::ChunkedLayout == H5D_CHUNKED,
+              "GenH5 and HDF5 layouts must match");
+
+namespace
+{
+
+/// position of the filter in the pipeline
+inline int
+filterRank(int id)
+{
+    switch (id)
+    {
+    case H5Z_FILTER_SCALEOFFSET:
+    case H5Z_FILTER_NBIT:
+        return 0;
+    case H5Z_FILTER_SHUFFLE:
+        return 1;
+    case H5Z_FILTER_FLETCHER32:
+        return 3;
+    default:
+        // compression filters
+        return 2;
+    }
+}
+
+} // namespace
+
+bool
+GenH5::FilterInfo::isOptional() const noexcept
+{
+    return flags & H5Z_FLAG_OPTIONAL;
+}
+
+bool
+GenH5::isFilterAvailable(int filterId) noexcept
+{
+    registerBuiltinFilters();
+
+    if (H5Zfilter_avail(static_cast<H5Z_filter_t>(filterId)) <= 0)
+    {
+        return false;
+    }
+
+    uint config{};
+    if (H5Zget_filter_info(static_cast<H5Z_filter_t>(filterId), &config) < 0)
+    {
+        return false;
+    }
+
+    return (config & H5Z_FILTER_CONFIG_ENCODE_ENABLED) &&
+           (config & H5Z_FILTER_CONFIG_DECODE_ENABLED);
+}
+
 GenH5::DataSetCProperties::DataSetCProperties() :
     m_id(H5Pcreate(H5P_DATASET_CREATE))
 {
@@ -49,21 +142,143 @@ GenH5::DataSetCProperties GenH5::DataSetCProperties::fromId(hid_t id) noexcept
     return d;
 }
 
+GenH5::DataSetCProperties
+GenH5::DataSetCProperties::defaultProperties(DataSpace const& dataspace,
+                                             DataType const& dtype,
+                                             size_t compactThreshold
+                                             ) noexcept(false)
+{
+    if (compactThreshold > s_maxCompactSize)
+    {
+        throw InvalidArgumentError{
+            GENH5_MAKE_EXECEPTION_STR() "Invalid compact threshold (" +
+            std::to_string(compactThreshold) + " > " +
+            std::to_string(s_maxCompactSize) + ')'
+        };
+    }
+
+    DataSetCProperties props;
+
+    if (dataspace.isNull()) return props;
+
+    auto const bytes = static_cast<size_t>(dataspace.size()) * dtype.size();
+    bool const isExtendable =
+            dataspace.maxDimensions() != dataspace.dimensions();
+
+    if (!isExtendable && bytes <= compactThreshold && compactThreshold > 0)
+    {
+        props.setLayout(CompactLayout);
+        return props;
+    }
+
+    // scalar and empty datasets cannot be chunked unless extendable
+    if (!isExtendable && (dataspace.isScalar() || dataspace.size() == 0))
+    {
+        props.setLayout(ContiguousLayout);
+        return props;
+    }
+
+    // chunk larger datasets so that they can be resized when overwritten
+    props.setChunkDimensions(autoChunk(dataspace, dtype));
+    return props;
+}
+
+size_t
+GenH5::DataSetCProperties::defaultChunkSize() noexcept
+{
+    return s_chunkSize;
+}
+
+void
+GenH5::DataSetCProperties::setDefaultChunkSize(size_t bytes) noexcept(false)
+{
+    // chunks must be smaller than 4 GiB
+    if (bytes == 0 || bytes > s_maxChunkSize)
+    {
+        throw InvalidArgumentError{
+            GENH5_MAKE_EXECEPTION_STR() "Invalid chunk size (" +
+            std::to_string(bytes) + ')'
+        };
+    }
+    s_chunkSize = bytes;
+}
+
 GenH5::Dimensions
-GenH5::DataSetCProperties::autoChunk(DataSpace const& dataspace) noexcept
+GenH5::DataSetCProperties::autoChunk(DataSpace const& dataspace,
+                                     size_t typeSize,
+                                     ChunkAccess access,
+                                     size_t chunkSize) noexcept
 {
     Dimensions dimensions = dataspace.dimensions();
+    Dimensions const maxDimensions = dataspace.maxDimensions();
+    int const nDims = dimensions.size();
 
-    std::replace_if(std::begin(dimensions), std::end(dimensions),
-                    std::bind(std::less<>(),
-                              std::placeholders::_1, 1ull),
-                    1ull);
+    if (chunkSize == 0) chunkSize = defaultChunkSize();
+    chunkSize = std::min(chunkSize, s_maxChunkSize);
 
-    // TODO: implement logic to generate optimal chunking layout
+    // number of elements per chunk
+    typeSize = std::max<size_t>(typeSize, 1);
+    hsize_t const target = std::max<hsize_t>(chunkSize / typeSize, 1);
+
+    // upper bound of each chunk dimension
+    for (int i = 0; i < nDims; ++i)
+    {
+        bool isUnlimited = i < maxDimensions.size() &&
+                           maxDimensions[i] == unlimited;
+        // unlimited dimensions may grow beyond the current extent
+        dimensions[i] = isUnlimited ? target :
+                                      std::max<hsize_t>(dimensions[i], 1);
+    }
+
+    // small datasets are stored in a single chunk
+    if (prod<hsize_t>(dimensions) <= target)
+    {
+        return dimensions;
+    }
+
+    switch (access)
+    {
+    case ChunkRowWise:
+    case ChunkColumnWise:
+    {
+        // fill the chunk starting at the trailing or leading dimension
+        hsize_t remaining = target;
+        for (int j = 0; j < nDims; ++j)
+        {
+            int i = access == ChunkRowWise ? nDims - 1 - j : j;
+            dimensions[i] = std::max<hsize_t>(
+                        std::min(dimensions[i], remaining), 1);
+            remaining /= dimensions[i];
+        }
+        break;
+    }
+    case ChunkTiled:
+    default:
+    {
+        // halve the largest dimension until the chunk is small enough
+        while (prod<hsize_t>(dimensions) > target)
+        {
+            auto iter = std::max_element(dimensions.begin(), dimensions.end());
+            if (*iter <= 1) break;
+            *iter = (*iter + 1) / 2;
+        }
+        break;
+    }
+    }
 
     return dimensions;
 }
 
+GenH5::Dimensions
+GenH5::DataSetCProperties::autoChunk(DataSpace const& dataspace,
+                                     DataType const& dtype,
+                                     ChunkAccess access,
+                                     size_t chunkSize) noexcept
+{
+    return autoChunk(dataspace, dtype.isValid() ? dtype.size() : 1,
+                     access, chunkSize);
+}
+
 GenH5::hid_t
 GenH5::DataSetCProperties::id() const noexcept
 {
@@ -133,6 +348,341 @@ GenH5::DataSetCProperties::setDeflate(int level) noexcept(false)
             GENH5_MAKE_EXECEPTION_STR() "Deflating failed"
         };
     }
+
+    sortFilters();
+}
+
+void
+GenH5::DataSetCProperties::setShuffle() noexcept(false)
+{
+    checkChunked("Setting shuffle filter failed");
+
+    if (H5Pset_shuffle(m_id) < 0)
+    {
+        throw PropertyListException{
+            GENH5_MAKE_EXECEPTION_STR() "Setting shuffle filter failed"
+        };
+    }
+
+    sortFilters();
+}
+
+void
+GenH5::DataSetCProperties::setScaleOffset(ScaleOffsetType type,
+                                          int factor) noexcept(false)
+{
+    checkChunked("Setting scale-offset filter failed");
+
+    if (factor < 0 ||
+        H5Pset_scaleoffset(m_id, static_cast<H5Z_SO_scale_type_t>(type),
+                           factor) < 0)
+    {
+        throw PropertyListException{
+            GENH5_MAKE_EXECEPTION_STR() "Setting scale-offset filter failed"
+        };
+    }
+
+    sortFilters();
+}
+
+void
+GenH5::DataSetCProperties::setNBit() noexcept(false)
+{
+    checkChunked("Setting n-bit filter failed");
+
+    if (H5Pset_nbit(m_id) < 0)
+    {
+        throw PropertyListException{
+            GENH5_MAKE_EXECEPTION_STR() "Setting n-bit filter failed"
+        };
+    }
+
+    sortFilters();
+}
+
+void
+GenH5::DataSetCProperties::setFletcher32() noexcept(false)
+{
+    checkChunked("Setting fletcher32 filter failed");
+
+    if (H5Pset_fletcher32(m_id) < 0)
+    {
+        throw PropertyListException{
+            GENH5_MAKE_EXECEPTION_STR() "Setting fletcher32 filter failed"
+        };
+    }
+
+    sortFilters();
+}
+
+void
+GenH5::DataSetCProperties::setLz4(int blockSize) noexcept(false)
+{
+    if (blockSize < 0)
+    {
+        throw PropertyListException{
+            GENH5_MAKE_EXECEPTION_STR() "Setting lz4 filter failed "
+            "(invalid block size)"
+        };
+    }
+
+    setOptionalFilter(FilterLz4, {static_cast<uint>(blockSize)},
+                      "Setting lz4 filter failed");
+}
+
+void
+GenH5::DataSetCProperties::setZstd(int level) noexcept(false)
+{
+    if (level < s_zstdMin || level > s_zstdMax)
+    {
+        int clamped = std::min(std::max(level, s_zstdMin), s_zstdMax);
+        log::ErrStream()
+                << GENH5_MAKE_EXECEPTION_STR()
+                   "Compression level must be within "
+                << s_zstdMin
+                << " and " << s_zstdMax << "! value: " << level
+                << ", using: " << clamped;
+        level = clamped;
+    }
+
+    setOptionalFilter(FilterZstd, {static_cast<uint>(level)},
+                      "Setting zstd filter failed");
+}
+
+void
+GenH5::DataSetCProperties::setShuffleLz4(int blockSize) noexcept(false)
+{
+    // check availability first, otherwise only the shuffle filter is set
+    if (!isFilterAvailable(FilterLz4))
+    {
+        throw PropertyListException{
+            GENH5_MAKE_EXECEPTION_STR() "Setting shuffle and lz4 filter "
+            "failed (lz4 filter not available)"
+        };
+    }
+
+    setShuffle();
+    setLz4(blockSize);
+}
+
+GenH5::Vector<GenH5::FilterInfo>
+GenH5::DataSetCProperties::filters() const noexcept
+{
+    Vector<FilterInfo> filters;
+
+    int n = H5Pget_nfilters(m_id);
+    filters.reserve(std::max(n, 0));
+
+    for (int i = 0; i < n; ++i)
+    {
+        FilterInfo info;
+
+        // retrieve number of parameters first
+        size_t nParams{0};
+        char name[256]{};
+        H5Z_filter_t id = H5Pget_filter2(m_id, i, &info.flags, &nParams,
+                                         nullptr, sizeof(name), name, nullptr);
+        if (id < 0) continue;
+
+        info.parameters.resize(static_cast<int>(nParams));
+        H5Pget_filter2(m_id, i, &info.flags, &nParams,
+                       info.parameters.data(), 0, nullptr, nullptr);
+
+        info.id = id;
+        info.name = QByteArray{name};
+        filters.push_back(std::move(info));
+    }
+
+    return filters;
+}
+
+bool
+GenH5::DataSetCProperties::hasFilter(int filterId) const noexcept
+{
+    auto const& filters = this->filters();
+    return std::any_of(filters.cbegin(), filters.cend(),
+                       [=](FilterInfo const& info){
+        return info.id == filterId;
+    });
+}
+
+void
+GenH5::DataSetCProperties::clearFilters() noexcept(false)
+{
+    if (H5Pget_nfilters(m_id) <= 0) return;
+
+    if (H5Premove_filter(m_id, H5Z_FILTER_ALL) < 0)
+    {
+        throw PropertyListException{
+            GENH5_MAKE_EXECEPTION_STR() "Removing filters failed"
+        };
+    }
+}
+
+void
+GenH5::DataSetCProperties::checkChunked(std::string const& msg
+                                        ) const noexcept(false)
+{
+    if (!isChunked())
+    {
+        throw PropertyListException{
+            GENH5_MAKE_EXECEPTION_STR() + msg +
+            " (dataset must be chunked first)"
+        };
+    }
+}
+
+void
+GenH5::DataSetCProperties::sortFilters() noexcept(false)
+{
+    auto filters = this->filters();
+
+    auto byRank = [](FilterInfo const& a, FilterInfo const& b){
+        return filterRank(a.id) < filterRank(b.id);
+    };
+    if (std::is_sorted(filters.cbegin(), filters.cend(), byRank)) return;
+
+    // pipeline must be rebuilt
+    std::stable_sort(filters.begin(), filters.end(), byRank);
+
+    clearFilters();
+    for (auto const& info : qAsConst(filters))
+    {
+        if (H5Pset_filter(m_id, static_cast<H5Z_filter_t>(info.id),
+                          info.flags, info.parameters.size(),
+                          info.parameters.constData()) < 0)
+        {
+            throw PropertyListException{
+                GENH5_MAKE_EXECEPTION_STR() "Reordering filters failed"
+            };
+        }
+    }
+}
+
+void
+GenH5::DataSetCProperties::setOptionalFilter(int filterId,
+                                             Vector<uint> const& parameters,
+                                             std::string const& msg
+                                             ) noexcept(false)
+{
+    checkChunked(msg);
+
+    if (!isFilterAvailable(filterId))
+    {
+        throw PropertyListException{
+            GENH5_MAKE_EXECEPTION_STR() + msg + " (filter not available)"
+        };
+    }
+
+    if (H5Pset_filter(m_id, static_cast<H5Z_filter_t>(filterId),
+                      H5Z_FLAG_OPTIONAL, parameters.size(),
+                      parameters.constData()) < 0)
+    {
+        throw PropertyListException{
+            GENH5_MAKE_EXECEPTION_STR() + msg
+        };
+    }
+
+    sortFilters();
+}
+
+void
+GenH5::DataSetCProperties::setFillValue(void const* value,
+                                        DataType const& dtype) noexcept(false)
+{
+    if (!value || H5Pset_fill_value(m_id, dtype.id(), value) < 0)
+    {
+        throw PropertyListException{
+            GENH5_MAKE_EXECEPTION_STR() "Setting fill value failed"
+        };
+    }
+}
+
+bool
+GenH5::DataSetCProperties::hasFillValue() const noexcept
+{
+    H5D_fill_value_t status{};
+    if (H5Pfill_value_defined(m_id, &status) < 0) return false;
+
+    return status == H5D_FILL_VALUE_USER_DEFINED;
+}
+
+bool
+GenH5::DataSetCProperties::fillValue(void* value,
+                                     DataType const& dtype) const noexcept
+{
+    return value && H5Pget_fill_value(m_id, dtype.id(), value) >= 0;
+}
+
+void
+GenH5::DataSetCProperties::setFillTime(FillTime time) noexcept(false)
+{
+    if (H5Pset_fill_time(m_id, static_cast<H5D_fill_time_t>(time)) < 0)
+    {
+        throw PropertyListException{
+            GENH5_MAKE_EXECEPTION_STR() "Setting fill time failed"
+        };
+    }
+}
+
+GenH5::FillTime
+GenH5::DataSetCProperties::fillTime() const noexcept
+{
+    H5D_fill_time_t time{H5D_FILL_TIME_IFSET};
+    H5Pget_fill_time(m_id, &time);
+    return static_cast<FillTime>(time);
+}
+
+void
+GenH5::DataSetCProperties::setAllocTime(AllocTime time) noexcept(false)
+{
+    if (H5Pset_alloc_time(m_id, static_cast<H5D_alloc_time_t>(time)) < 0)
+    {
+        throw PropertyListException{
+            GENH5_MAKE_EXECEPTION_STR() "Setting allocation time failed"
+        };
+    }
+}
+
+GenH5::AllocTime
+GenH5::DataSetCProperties::allocTime() const noexcept
+{
+    H5D_alloc_time_t time{H5D_ALLOC_TIME_DEFAULT};
+    if (H5Pget_alloc_time(m_id, &time) < 0) return AllocDefault;
+    return static_cast<AllocTime>(time);
+}
+
+void
+GenH5::DataSetCProperties::setLayout(DataSetLayout layout) noexcept(false)
+{
+    if (layout == ChunkedLayout && !isChunked())
+    {
+        throw PropertyListException{
+            GENH5_MAKE_EXECEPTION_STR()
+            "Setting chunked layout failed (chunk dimensions must be set)"
+        };
+    }
+
+    if (layout != ChunkedLayout && H5Pget_nfilters(m_id) > 0)
+    {
+        throw PropertyListException{
+            GENH5_MAKE_EXECEPTION_STR()
+            "Setting layout failed (filters require the chunked layout)"
+        };
+    }
+
+    if (H5Pset_layout(m_id, static_cast<H5D_layout_t>(layout)) < 0)
+    {
+        throw PropertyListException{
+            GENH5_MAKE_EXECEPTION_STR() "Setting layout failed"
+        };
+    }
+}
+
+GenH5::DataSetLayout
+GenH5::DataSetCProperties::layout() const noexcept
+{
+    return static_cast<DataSetLayout>(H5Pget_layout(m_id));
 }
 
 bool
@@ -141,6 +691,18 @@ GenH5::DataSetCProperties::isChunked() const noexcept
     return H5Pget_layout(m_id) == H5D_layout_t::H5D_CHUNKED;
 }
 
+bool
+GenH5::DataSetCProperties::isCompact() const noexcept
+{
+    return H5Pget_layout(m_id) == H5D_layout_t::H5D_COMPACT;
+}
+
+bool
+GenH5::DataSetCProperties::isContiguous() const noexcept
+{
+    return H5Pget_layout(m_id) == H5D_layout_t::H5D_CONTIGUOUS;
+}
+
 bool
 GenH5::DataSetCProperties::isDeflated() const noexcept
 {
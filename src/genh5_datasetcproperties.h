@@ -12,11 +12,138 @@
 
 #include "genh5_idcomponent.h"
 #include "genh5_object.h"
+#include "genh5_data/comp0d.h"
+
+#include <string>
 
 namespace GenH5
 {
 // forward decl
 class DataSpace;
+class DataType;
+
+/**
+ * @brief The ChunkAccess enum. Describes how a dataset is accessed mostly.
+ * Used to determine the shape of the chunks.
+ */
+enum ChunkAccess
+{
+    /// chunks have about the same extent in each dimension (e.g. for tiles)
+    ChunkTiled = 0,
+    /// chunks span the trailing dimensions (e.g. reading rows of a matrix)
+    ChunkRowWise = 1,
+    /// chunks span the leading dimensions (e.g. reading columns of a matrix)
+    ChunkColumnWise = 2
+};
+
+/**
+ * @brief The DataSetLayout enum. Storage layout of the raw data of a dataset.
+ */
+enum DataSetLayout
+{
+    /// data is stored in the object header, only for small datasets
+    CompactLayout = 0,
+    /// data is stored in a single block, cannot be resized or compressed
+    ContiguousLayout = 1,
+    /// data is stored in chunks, required for resizing and compression
+    ChunkedLayout = 2
+};
+
+/**
+ * @brief The FillTime enum. When fill values are written to the dataset.
+ */
+enum FillTime
+{
+    /// fill values are written when the storage is allocated
+    FillOnAlloc = 0,
+    /// fill values are never written, unwritten elements are undefined
+    FillNever = 1,
+    /// fill values are written only if a fill value was set (default)
+    FillIfSet = 2
+};
+
+/**
+ * @brief The AllocTime enum. When the storage of a dataset is allocated.
+ */
+enum AllocTime
+{
+    /// depends on the layout (compact: early, contiguous: late,
+    /// chunked: incremental)
+    AllocDefault = 0,
+    /// storage is allocated when the dataset is created
+    AllocEarly = 1,
+    /// storage is allocated when the dataset is written first
+    AllocLate = 2,
+    /// storage of a chunk is allocated when the chunk is written first
+    AllocIncremental = 3
+};
+
+/**
+ * @brief The FilterId enum. Identifiers of the predefined filters. Custom
+ * filters may use any registered identifier.
+ */
+enum FilterId
+{
+    FilterDeflate = 1,
+    FilterShuffle = 2,
+    FilterFletcher32 = 3,
+    FilterSzip = 4,
+    FilterNBit = 5,
+    FilterScaleOffset = 6,
+    /// registered LZ4 filter, built in if GenH5 was built with LZ4 support
+    FilterLz4 = 32004,
+    /// registered Zstandard filter, built in if GenH5 was built with Zstd
+    /// support
+    FilterZstd = 32015
+};
+
+/**
+ * @brief The ScaleOffsetType enum. Scaling method of the scale-offset filter.
+ */
+enum ScaleOffsetType
+{
+    /// floating point data, keeps the given number of decimal digits
+    ScaleFloatDecimal = 0,
+    /// integer data, stores the given number of bits (0 = computed)
+    ScaleInteger = 2
+};
+
+/**
+ * @brief The FilterInfo struct. Describes a filter of the filter pipeline.
+ */
+struct GENH5_EXPORT FilterInfo
+{
+    /// filter identifier
+    int id{-1};
+    /// name of the filter
+    String name{};
+    /// filter flags (e.g. optional)
+    uint flags{};
+    /// client data values of the filter
+    Vector<uint> parameters{};
+
+    /**
+     * @brief Whether the filter may fail without failing the pipeline
+     * @return is optional
+     */
+    bool isOptional() const noexcept;
+};
+
+/**
+ * @brief Whether the filter is available for encoding and decoding data.
+ * @param filterId Filter identifier
+ * @return is available
+ */
+GENH5_EXPORT bool isFilterAvailable(int filterId) noexcept;
+
+/**
+ * @brief Registers the compression filters built into GenH5 (LZ4 and
+ * Zstandard, depending on the build configuration). Is called automatically
+ * when opening a file or when setting a filter, thus calling it manually is
+ * only necessary when using the HDF5 C API directly.
+ * @return success
+ */
+GENH5_EXPORT bool registerBuiltinFilters() noexcept;
 
 class GENH5_EXPORT DataSetCProperties : public Object
 {
@@ -25,12 +152,86 @@ public:
     /// Instantiates a new Datatype and assigns the id without incrementing it
     static DataSetCProperties fromId(hid_t id) noexcept;
 
-    static Dimensions autoChunk(DataSpace const& dataspace) noexcept;
+    /**
+     * @brief Default create properties used by `Group::createDataSet`.
+     * Fixed-size datasets up to `compactThreshold` bytes use the compact
+     * layout. All other datasets are chunked (see `autoChunk`) so that they
+     * can be resized when overwritten, except for scalar and empty datasets,
+     * which use the contiguous layout. Chunked datasets are not compressed.
+     * @throws InvalidArgumentError if the threshold exceeds the maximum size
+     * of compact datasets (63 KiB)
+     * @param dataspace Dataspace of the dataset
+     * @param dtype Datatype of the dataset
+     * @param compactThreshold Size in bytes up to which datasets are stored
+     * compact. Zero disables the compact layout.
+     * @return create properties
+     */
+    static DataSetCProperties defaultProperties(DataSpace const& dataspace,
+                                                DataType const& dtype,
+                                                size_t compactThreshold = 4096
+                                                ) noexcept(false);
+
+    /**
+     * @brief Targeted size of a chunk in bytes used by `autoChunk`. Defaults
+     * to 1 MiB (i.e. the size of the default chunk cache).
+     * @return chunk size in bytes
+     */
+    static size_t defaultChunkSize() noexcept;
+
+    /**
+     * @brief Sets the targeted size of a chunk in bytes used by `autoChunk`.
+     * Sizes between 256 KiB and 4 MiB are recommended.
+     * @throws InvalidArgumentError if the size is zero or exceeds 4 GiB
+     * @param bytes chunk size in bytes
+     */
+    static void setDefaultChunkSize(size_t bytes) noexcept(false);
+
+    /**
+     * @brief Chunk dimensions for the dataspace, such that a chunk holds
+     * about `chunkSize` bytes. Datasets that are smaller are stored in a
+     * single chunk. Unlimited dimensions may exceed the current extent.
+     * @param dataspace Dataspace of the dataset
+     * @param typeSize Size of an element in bytes
+     * @param access Shape of the chunks
+     * @param chunkSize Targeted chunk size in bytes. Uses
+     * `defaultChunkSize` if zero.
+     * @return chunk dimensions
+     */
+    static Dimensions autoChunk(DataSpace const& dataspace,
+                                size_t typeSize,
+                                ChunkAccess access = ChunkTiled,
+                                size_t chunkSize = 0) noexcept;
+
+    /// overload, treats each element as a single byte. Thus the chunks exceed
+    /// the targeted chunk size for larger datatypes.
+    [[deprecated("use autoChunk(dataspace, dtype) instead")]]
+    static Dimensions autoChunk(DataSpace const& dataspace) noexcept
+    {
+        return autoChunk(dataspace, 1);
+    }
+
+    /// overload using the size of the datatype
+    static Dimensions autoChunk(DataSpace const& dataspace,
+                                DataType const& dtype,
+                                ChunkAccess access = ChunkTiled,
+                                size_t chunkSize = 0) noexcept;
 
+    /// treats each element as a single byte (see `autoChunk`)
+    [[deprecated("use autoChunked(dataspace, dtype) instead")]]
     static DataSetCProperties autoChunked(DataSpace const& dataspace,
                                           int compression = 0) noexcept(false)
     {
-        return DataSetCProperties{autoChunk(dataspace), compression};
+        return DataSetCProperties{autoChunk(dataspace, 1), compression};
+    }
+
+    static DataSetCProperties autoChunked(DataSpace const& dataspace,
+                                          DataType const& dtype,
+                                          int compression = 0,
+                                          ChunkAccess access = ChunkTiled
+                                          ) noexcept(false)
+    {
+        return DataSetCProperties{autoChunk(dataspace, dtype, access),
+                                  compression};
     }
 
     DataSetCProperties();
@@ -57,12 +258,204 @@ public:
      */
     void setDeflate(int level) noexcept(false);
 
+    /**
+     * @brief Adds the byte shuffle filter. Improves the compression ratio of
+     * numeric data. Can only be used once the chunk dimensions are set.
+     */
+    void setShuffle() noexcept(false);
+
+    /**
+     * @brief Adds the scale-offset filter. The filter is lossy for floating
+     * point data. Can only be used once the chunk dimensions are set.
+     * @param type Scaling method
+     * @param factor Decimal digits to keep for floating point data or number
+     * of bits for integer data
+     */
+    void setScaleOffset(ScaleOffsetType type, int factor) noexcept(false);
+
+    /**
+     * @brief Adds the n-bit filter, which stores only the significant bits of
+     * the datatype. Can only be used once the chunk dimensions are set.
+     */
+    void setNBit() noexcept(false);
+
+    /**
+     * @brief Adds the fletcher32 checksum filter. Can only be used once the
+     * chunk dimensions are set.
+     */
+    void setFletcher32() noexcept(false);
+
+    /**
+     * @brief Adds the LZ4 compression filter. Very fast, but with a lower
+     * compression ratio than deflate. Can only be used once the chunk
+     * dimensions are set.
+     * @param blockSize Size of the blocks that are compressed individually in
+     * bytes (0 = whole chunk)
+     */
+    void setLz4(int blockSize = 0) noexcept(false);
+
+    /**
+     * @brief Adds the Zstandard compression filter. Can only be used once the
+     * chunk dimensions are set.
+     * @param level compression level between 1 (fast) and 22 (max)
+     */
+    void setZstd(int level = 3) noexcept(false);
+
+    /**
+     * @brief Adds the byte shuffle and the LZ4 compression filter. Combines
+     * the compression speed of LZ4 with the improved compression ratio of
+     * shuffled numeric data. Can only be used once the chunk dimensions are
+     * set.
+     * @param blockSize Size of the blocks that are compressed individually in
+     * bytes (0 = whole chunk)
+     */
+    void setShuffleLz4(int blockSize = 0) noexcept(false);
+
+    /**
+     * @brief Filter pipeline in the order the filters are applied when
+     * writing data. Filters are ordered as follows: scale-offset and n-bit,
+     * shuffle, compression filters, fletcher32.
+     * @return filters
+     */
+    Vector<FilterInfo> filters() const noexcept;
+
+    /**
+     * @brief Whether the filter is part of the filter pipeline.
+     * @param filterId Filter identifier
+     * @return has filter
+     */
+    bool hasFilter(int filterId) const noexcept;
+
+    /**
+     * @brief Removes all filters from the pipeline.
+     */
+    void clearFilters() noexcept(false);
+
+    /**
+     * @brief Sets the fill value, which is used for elements that were not
+     * written.
+     * @param value Pointer to the fill value
+     * @param dtype Datatype of the fill value
+     */
+    void setFillValue(void const* value,
+                      DataType const& dtype) noexcept(false);
+
+    /**
+     * @brief Overload. Sets the fill value using the data and its datatype.
+     * @param value Fill value
+     */
+    template <typename T>
+    void setFillValue(details::AbstractData<T> const& value) noexcept(false)
+    {
+        setFillValue(value.dataWritePtr(), value.dataType());
+    }
+
+    /**
+     * @brief Overload. Sets the fill value using the datatype of `T`.
+     * @param value Fill value
+     */
+    template <typename T, traits::if_has_not_template_type<T> = true>
+    void setFillValue(T const& value) noexcept(false)
+    {
+        setFillValue(makeData0D(value));
+    }
+
+    /**
+     * @brief Whether a fill value was set (i.e. the default fill value is
+     * not used)
+     * @return has fill value
+     */
+    bool hasFillValue() const noexcept;
+
+    /**
+     * @brief Reads the fill value. Returns the default fill value (zero) if
+     * no fill value was set.
+     * @param value Pointer to the fill value
+     * @param dtype Datatype of the fill value
+     * @return success
+     */
+    bool fillValue(void* value, DataType const& dtype) const noexcept;
+
+    /**
+     * @brief Overload. Returns the fill value as 0D data. Only types of a
+     * fixed size are supported.
+     * @return fill value
+     */
+    template <typename T>
+    Data0D<T> fillValue() const noexcept(false)
+    {
+        Data0D<T> value;
+        if (!fillValue(value.dataReadPtr(), value.dataType()))
+        {
+            throw PropertyListException{
+                GENH5_MAKE_EXECEPTION_STR() "Reading fill value failed"
+            };
+        }
+        return value;
+    }
+
+    /**
+     * @brief Sets when fill values are written. Datasets that are written
+     * entirely anyway should use `FillNever`, such that the data is not
+     * written twice. Cannot be used with variable length data.
+     * @param time Fill time
+     */
+    void setFillTime(FillTime time) noexcept(false);
+
+    /**
+     * @brief When fill values are written
+     * @return fill time
+     */
+    FillTime fillTime() const noexcept;
+
+    /**
+     * @brief Sets when the storage of the dataset is allocated. Together
+     * with `FillNever` and `AllocLate` or `AllocIncremental` creating and
+     * writing a dataset requires a single pass over the data.
+     * @param time Allocation time
+     */
+    void setAllocTime(AllocTime time) noexcept(false);
+
+    /**
+     * @brief When the storage of the dataset is allocated
+     * @return allocation time
+     */
+    AllocTime allocTime() const noexcept;
+
+    /**
+     * @brief Sets the storage layout. Use `setChunkDimensions` for the chunked
+     * layout.
+     * @throws PropertyListException if the chunked layout is set without
+     * chunk dimensions or if a compact or contiguous dataset would be
+     * compressed
+     * @param layout Storage layout
+     */
+    void setLayout(DataSetLayout layout) noexcept(false);
+
+    /**
+     * @brief Storage layout
+     * @return layout
+     */
+    DataSetLayout layout() const noexcept;
+
     /**
      * @brief isChunked
      * @return whether chunking is set
      */
     bool isChunked() const noexcept;
 
+    /**
+     * @brief isCompact
+     * @return whether the compact layout is set
+     */
+    bool isCompact() const noexcept;
+
+    /**
+     * @brief isContiguous
+     * @return whether the contiguous layout is set
+     */
+    bool isContiguous() const noexcept;
+
     /**
      * @brief Whether compression is enabled (using gzip deflate)
      * @return is compressed
@@ -88,6 +481,16 @@ private:
 
     /// create properties id
     IdComponent<IdType::PropertyList> m_id;
+
+    /// throws if the dataset is not chunked
+    void checkChunked(std::string const& msg) const noexcept(false);
+
+    /// restores the order of the filter pipeline
+    void sortFilters() noexcept(false);
+
+    /// adds an optional filter that is not predefined by HDF5
+    void setOptionalFilter(int filterId, Vector<uint> const& parameters,
+                           std::string const& msg) noexcept(false);
 };
 
 } // namespace GenH5
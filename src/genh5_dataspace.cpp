@@ -70,6 +70,26 @@ GenH5::DataSpace::DataSpace(Dimensions const& dimensions) noexcept(false) :
     }
 }
 
+GenH5::DataSpace::DataSpace(Dimensions const& dimensions,
+                            Dimensions const& maxDimensions) noexcept(false) :
+    m_id([&dimensions, &maxDimensions] () -> hid_t {
+        if (dimensions.size() != maxDimensions.size()) return -1;
+
+        auto const& h5Dimensions = compat::toH5Dimensions(dimensions);
+        auto const& h5MaxDimensions = compat::toH5Dimensions(maxDimensions);
+        return H5Screate_simple(h5Dimensions.size(),
+                                h5Dimensions.constData(),
+                                h5MaxDimensions.constData());
+    }())
+{
+    if (m_id < 0)
+    {
+        throw DataSpaceException{
+            GENH5_MAKE_EXECEPTION_STR() "Failed to create extendable dataspace"
+        };
+    }
+}
+
 GenH5::DataSpace::DataSpace(std::initializer_list<hsize_t> initlist
                             ) noexcept(false) :
     DataSpace{Dimensions{initlist}}
@@ -113,6 +133,23 @@ GenH5::DataSpace::dimensions() const noexcept
     return compat::fromH5Dimensions(dimensions);
 }
 
+GenH5::Dimensions
+GenH5::DataSpace::maxDimensions() const noexcept
+{
+    static_assert(unlimited == H5S_UNLIMITED,
+                  "GenH5 and HDF5 unlimited dimensions must be equal");
+
+    auto size = nDims();
+    if (size < 0)
+    {
+        return {};
+    }
+
+    compat::H5Dimensions dimensions(size);
+    H5Sget_simple_extent_dims(m_id, nullptr, dimensions.data());
+    return compat::fromH5Dimensions(dimensions);
+}
+
 GenH5::hssize_t
 GenH5::DataSpace::selectionSize() const noexcept
 {
@@ -17,6 +17,9 @@
 namespace GenH5
 {
 
+/// maximum dimension of a dataspace that can be extended indefinitely
+constexpr hsize_t unlimited = static_cast<hsize_t>(-1);
+
 /**
  * @brief The DataSpace class
  */
@@ -56,6 +59,15 @@ public:
     explicit DataSpace(hid_t id);
     explicit DataSpace(std::initializer_list<hsize_t> initlist) noexcept(false);
     explicit DataSpace(Dimensions const& dimensions) noexcept(false);
+    /**
+     * @brief Dataspace that can be extended up to the maximum dimensions. Use
+     * `unlimited` for dimensions that can be extended indefinitely. Datasets
+     * using an extendable dataspace must be chunked.
+     * @param dimensions Current dimensions
+     * @param maxDimensions Maximum dimensions. Must have the same length.
+     */
+    DataSpace(Dimensions const& dimensions,
+              Dimensions const& maxDimensions) noexcept(false);
 
     /**
      * @brief id or handle of the hdf5 resource
@@ -89,6 +101,13 @@ public:
      */
     Dimensions dimensions() const noexcept;
 
+    /**
+     * @brief vector containing the maximum size of each dimension. Equals
+     * `unlimited` if a dimension can be extended indefinitely.
+     * @return maximum dimensions
+     */
+    Dimensions maxDimensions() const noexcept;
+
     /**
      * @brief Selection size of this dataspace. If selection was not explicitly
      * set, selection size is equal to size.
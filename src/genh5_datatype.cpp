@@ -13,6 +13,14 @@
 
 #include <H5Tpublic.h>
 
+#include <algorithm>
+#include <cassert>
+#include <mutex>
+#include <string_view>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
 namespace GenH5
 {
 
@@ -31,8 +39,300 @@ inline DataType makePredType(hid_t id)
     return GenH5::DataType::fromId(H5Tcopy(id));
 }
 
+/// creates a little endian floating point type of two bytes
+inline DataType makeFloatType(size_t spos, size_t epos, size_t esize,
+                              size_t mpos, size_t msize, size_t ebias)
+{
+    auto type = makePredType(H5T_IEEE_F32LE);
+    if (H5Tset_fields(type.id(), spos, epos, esize, mpos, msize) < 0 ||
+        H5Tset_size(type.id(), 2) < 0 ||
+        H5Tset_ebias(type.id(), ebias) < 0)
+    {
+        throw DataTypeException{
+            GENH5_MAKE_EXECEPTION_STR() "Creating floating point type failed"
+        };
+    }
+    return type;
+}
+
 } // namespace GenH5
 
+namespace
+{
+
+inline void
+hashCombine(size_t& seed, size_t value)
+{
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+inline size_t
+hashString(GenH5::String const& string)
+{
+    return std::hash<std::string_view>{}(
+        std::string_view{string.constData(), static_cast<size_t>(string.size())}
+    );
+}
+
+/// Structural hash of a datatype. Must only consider properties that are
+/// compared by `operator==`
+size_t
+structuralHash(GenH5::DataType const& dtype) noexcept(false)
+{
+    using GenH5::DataTypeClass;
+
+    auto const classType = dtype.type();
+
+    size_t seed = static_cast<size_t>(classType);
+    hashCombine(seed, dtype.size());
+
+    switch (classType)
+    {
+    case DataTypeClass::Enum:
+    {
+        // order of members is not relevant
+        auto members = dtype.enumMembers();
+        std::sort(std::begin(members), std::end(members),
+                  [](auto const& a, auto const& b){
+            return a.value < b.value;
+        });
+        for (auto const& member : qAsConst(members))
+        {
+            hashCombine(seed, hashString(member.name));
+            hashCombine(seed, static_cast<size_t>(member.value));
+        }
+        break;
+    }
+    case DataTypeClass::String:
+        hashCombine(seed, dtype.isVarString());
+        break;
+    case DataTypeClass::VarLen:
+        hashCombine(seed, dtype.superType().hash());
+        break;
+    case DataTypeClass::Array:
+        for (auto dim : dtype.arrayDimensions())
+        {
+            hashCombine(seed, static_cast<size_t>(dim));
+        }
+        hashCombine(seed, dtype.superType().hash());
+        break;
+    case DataTypeClass::Compound:
+        for (auto const& member : dtype.compoundMembers())
+        {
+            hashCombine(seed, hashString(member.name));
+            hashCombine(seed, member.offset);
+            hashCombine(seed, member.type.hash());
+        }
+        break;
+    default:
+        break;
+    }
+
+    return seed;
+}
+
+/// Interned datatype
+struct InternedType
+{
+    std::type_index type;
+    GenH5::Vector<GenH5::String> names;
+    GenH5::DataType dtype;
+};
+
+/// Precomputed properties of an interned datatype
+struct InternedInfo
+{
+    /// structural hash
+    size_t hash;
+    /// id of the first interned type that is equal to this type
+    GenH5::hid_t canonical;
+};
+
+/// Process-wide registry of interned datatypes. The registry is updated in
+/// place and guarded by a mutex. Types without member names are additionally
+/// cached per C++ type (see `internedDataType`), thus lookups of these types
+/// do not lock.
+struct DataTypeRegistry
+{
+    /// maximum number of interned types with member names. Member names may
+    /// be chosen at runtime, thus further types are not interned to bound the
+    /// memory and the number of ids retained by the registry
+    static constexpr size_t maxNamedTypes = 1024;
+
+    /// serializes writers. Interned types are compared while the registry is
+    /// not locked, since comparing datatypes accesses the registry
+    std::mutex writerMutex;
+    /// guards the members below
+    mutable std::mutex mutex;
+    /// interned types by hash of the C++ type and the member names
+    std::unordered_multimap<size_t, InternedType> types;
+    /// precomputed properties of interned types by id
+    std::unordered_map<GenH5::hid_t, InternedInfo> infos;
+    /// number of interned types with member names
+    size_t namedTypes{0};
+
+    /// The registry is never destroyed, since the interned ids must not be
+    /// released after the library was terminated (static destruction order).
+    /// The ids are released by HDF5 when closing the library.
+    static DataTypeRegistry& instance()
+    {
+        static auto* registry = new DataTypeRegistry;
+        return *registry;
+    }
+
+    static size_t key(std::type_info const& type,
+                      GenH5::String const* names,
+                      size_t nNames)
+    {
+        size_t seed = type.hash_code();
+        for (size_t i = 0; i < nNames; ++i)
+        {
+            hashCombine(seed, hashString(names[i]));
+        }
+        return seed;
+    }
+
+    /// mutex must be locked
+    GenH5::DataType const* find(size_t key,
+                                std::type_info const& type,
+                                GenH5::String const* names,
+                                size_t nNames) const
+    {
+        auto range = types.equal_range(key);
+        for (auto iter = range.first; iter != range.second; ++iter)
+        {
+            auto const& entry = iter->second;
+            if (entry.type == std::type_index{type} &&
+                static_cast<size_t>(entry.names.size()) == nNames &&
+                std::equal(entry.names.cbegin(), entry.names.cend(),
+                           names))
+            {
+                return &entry.dtype;
+            }
+        }
+        return nullptr;
+    }
+
+    /// mutex must be locked
+    InternedInfo const* findInfo(GenH5::hid_t id) const
+    {
+        auto iter = infos.find(id);
+        return iter != infos.end() ? &iter->second : nullptr;
+    }
+};
+
+} // namespace
+
+GenH5::DataType
+GenH5::details::findInternedDataType(std::type_info const& type,
+                                     String const* names,
+                                     size_t nNames) noexcept
+{
+    auto& registry = DataTypeRegistry::instance();
+    auto key = DataTypeRegistry::key(type, names, nNames);
+
+    std::lock_guard<std::mutex> lock{registry.mutex};
+
+    auto const* dtype = registry.find(key, type, names, nNames);
+    return dtype ? *dtype : DataType{};
+}
+
+GenH5::DataType
+GenH5::details::internDataType(std::type_info const& type,
+                               String const* names,
+                               size_t nNames,
+                               DataType dtype) noexcept(false)
+{
+    if (!dtype.isValid())
+    {
+        throw DataTypeException{
+            GENH5_MAKE_EXECEPTION_STR() "Failed to intern datatype "
+            "(invalid id)"
+        };
+    }
+
+    auto hash = structuralHash(dtype);
+
+    auto& registry = DataTypeRegistry::instance();
+    auto key = DataTypeRegistry::key(type, names, nNames);
+
+    std::lock_guard<std::mutex> writerLock{registry.writerMutex};
+
+    // types that may be equal to dtype
+    std::vector<DataType> candidates;
+    {
+        std::lock_guard<std::mutex> lock{registry.mutex};
+
+        // may have been interned concurrently
+        if (auto const* interned = registry.find(key, type, names, nNames))
+        {
+            return *interned;
+        }
+
+        // registry is full -> use the type as is
+        if (nNames > 0 &&
+            registry.namedTypes >= DataTypeRegistry::maxNamedTypes)
+        {
+            return dtype;
+        }
+
+        if (!registry.findInfo(dtype.id()))
+        {
+            for (auto const& entry : registry.types)
+            {
+                auto const* other = registry.findInfo(entry.second.dtype.id());
+                assert(other);
+                if (other->hash == hash &&
+                    other->canonical == entry.second.dtype.id())
+                {
+                    candidates.push_back(entry.second.dtype);
+                }
+            }
+        }
+    }
+
+    // the canonical id is the id of the first interned type that is equal.
+    // Thus interned types are equal if and only if their canonical ids match
+    InternedInfo info{hash, dtype.id()};
+    for (auto const& candidate : candidates)
+    {
+        if (candidate == dtype)
+        {
+            info.canonical = candidate.id();
+            break;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock{registry.mutex};
+
+    registry.infos.insert({dtype.id(), info});
+    registry.types.insert({key, InternedType{
+        std::type_index{type},
+        Vector<String>(names, names + nNames),
+        dtype
+    }});
+
+    if (nNames > 0) registry.namedTypes++;
+
+    return dtype;
+}
+
+size_t
+GenH5::details::internedDataTypeCount() noexcept
+{
+    auto& registry = DataTypeRegistry::instance();
+
+    std::lock_guard<std::mutex> lock{registry.mutex};
+
+    return registry.types.size();
+}
+
+size_t
+GenH5::details::maxInternedNamedDataTypes() noexcept
+{
+    return DataTypeRegistry::maxNamedTypes;
+}
+
 GenH5::DataType const&
 GenH5::DataType::Bool()
 {
@@ -150,6 +450,17 @@ GenH5::DataType const& GenH5::DataType::Double()
     return type;
 }
 
+GenH5::DataType const& GenH5::DataType::Float16()
+{
+    static DataType type = makeFloatType(15, 10, 5, 0, 10, 15);
+    return type;
+}
+GenH5::DataType const& GenH5::DataType::BFloat16()
+{
+    static DataType type = makeFloatType(15, 7, 8, 0, 7, 127);
+    return type;
+}
+
 GenH5::DataType const& GenH5::DataType::VarString()
 {
     static DataType type = GenH5::DataType::varString();
@@ -285,6 +596,49 @@ GenH5::DataType::compound(size_t dataSize,
     return dtype;
 }
 
+GenH5::DataType
+GenH5::DataType::enumeration(DataType const& baseType,
+                             EnumMembers const& members) noexcept(false)
+{
+    static const std::string errMsg =
+            GENH5_MAKE_EXECEPTION_STR() "Failed to create enum type";
+
+    if (!baseType.isInt())
+    {
+        throw DataTypeException{
+            GENH5_MAKE_EXECEPTION_STR()
+            "Failed to create enum type (base type must be an integer type)"
+        };
+    }
+
+    // create type
+    DataType dtype = makeType([id = baseType.m_id](){
+        return H5Tenum_create(id);
+    }, errMsg);
+
+    // insert members
+    for (int i = 0; i < members.length(); ++i)
+    {
+        auto const& m = members.at(i);
+
+        // value must be stored in the base type's representation
+        qlonglong value = m.value;
+        if (H5Tconvert(H5T_NATIVE_LLONG, baseType.m_id, 1, &value,
+                       nullptr, H5P_DEFAULT) < 0 ||
+            H5Tenum_insert(dtype.m_id, m.name.constData(), &value) < 0)
+        {
+            throw DataTypeException{
+                GENH5_MAKE_EXECEPTION_STR() "Failed to insert member no. " +
+                std::to_string(i) + " into enum type (name: '" +
+                m.name.toStdString() + "', value: " +
+                std::to_string(m.value) + ")"
+            };
+        }
+    }
+
+    return dtype;
+}
+
 GenH5::DataType
 GenH5::DataType::fromId(hid_t id) noexcept
 {
@@ -349,6 +703,12 @@ GenH5::DataType::isCompound() const noexcept
     return type() == DataTypeClass::Compound;
 }
 
+bool
+GenH5::DataType::isEnum() const noexcept
+{
+    return type() == DataTypeClass::Enum;
+}
+
 bool
 GenH5::DataType::isVarLen() const noexcept
 {
@@ -433,6 +793,51 @@ GenH5::DataType::compoundMembers() const
     return members;
 }
 
+GenH5::EnumMembers
+GenH5::DataType::enumMembers() const noexcept(false)
+{
+    if (!isEnum())
+    {
+        return {};
+    }
+
+    int n = H5Tget_nmembers(m_id);
+
+    if (n < 1)
+    {
+        return {};
+    }
+
+    DataType const base = superType();
+
+    EnumMembers members;
+    members.reserve(n);
+
+    for (uint i = 0; i < static_cast<uint>(n); ++i)
+    {
+        char* str = H5Tget_member_name(m_id, i);
+        String memberName{str};
+        H5free_memory(str);
+
+        // value is stored in the base type's representation
+        qlonglong value = 0;
+        if (H5Tget_member_value(m_id, i, &value) < 0 ||
+            H5Tconvert(base.m_id, H5T_NATIVE_LLONG, 1, &value,
+                       nullptr, H5P_DEFAULT) < 0)
+        {
+            throw DataTypeException{
+                GENH5_MAKE_EXECEPTION_STR()
+                "Failed to access value of enum member no. " +
+                std::to_string(i)
+            };
+        }
+
+        members.append({std::move(memberName), value});
+    }
+
+    return members;
+}
+
 GenH5::DataType
 GenH5::DataType::superType() const noexcept(false)
 {
@@ -451,6 +856,58 @@ GenH5::DataType::superType() const noexcept(false)
     }, errMsg);
 }
 
+GenH5::DataType
+GenH5::DataType::packed() const noexcept(false)
+{
+    static const std::string errMsg =
+            GENH5_MAKE_EXECEPTION_STR() "Failed to pack datatype";
+
+    if (!isValid())
+    {
+        throw DataTypeException{
+            GENH5_MAKE_EXECEPTION_STR() "Failed to pack datatype (invalid id)"
+        };
+    }
+
+    // nothing to pack
+    if (H5Tdetect_class(m_id, H5T_COMPOUND) <= 0)
+    {
+        return *this;
+    }
+
+    return makeType([id = m_id](){
+        hid_t copy = H5Tcopy(id);
+        if (copy >= 0 && H5Tpack(copy) < 0)
+        {
+            H5Tclose(copy);
+            return hid_t{-1};
+        }
+        return copy;
+    }, errMsg);
+}
+
+size_t
+GenH5::DataType::hash() const noexcept(false)
+{
+    if (!isValid())
+    {
+        throw DataTypeException{
+            GENH5_MAKE_EXECEPTION_STR() "Failed to hash datatype (invalid id)"
+        };
+    }
+
+    // precomputed hash of interned types
+    {
+        auto& registry = DataTypeRegistry::instance();
+
+        std::lock_guard<std::mutex> lock{registry.mutex};
+
+        if (auto const* info = registry.findInfo(m_id)) return info->hash;
+    }
+
+    return structuralHash(*this);
+}
+
 void
 GenH5::DataType::swap(DataType& other) noexcept
 {
@@ -551,6 +1008,20 @@ operator==(GenH5::DataType const& first, GenH5::DataType const& other)
         return true;
     }
 
+    // interned types -> compare canonical ids
+    {
+        auto& registry = DataTypeRegistry::instance();
+
+        std::lock_guard<std::mutex> lock{registry.mutex};
+
+        auto const* fInfo = registry.findInfo(first.id());
+        auto const* oInfo = registry.findInfo(other.id());
+        if (fInfo && oInfo)
+        {
+            return fInfo->canonical == oInfo->canonical;
+        }
+    }
+
     GenH5::DataTypeClass const classType = first.type();
 
     // class types differ -> exit
@@ -565,12 +1036,36 @@ operator==(GenH5::DataType const& first, GenH5::DataType const& other)
     switch (classType)
     {
     case GenH5::DataTypeClass::Enum:
-        // TODO: Check enum values and names
-        return isSameSize &&
-               H5Tget_nmembers(first.id()) == H5Tget_nmembers(other.id());
+        if (isSameSize)
+        {
+            // order of members is not relevant
+            auto byValue = [](auto const& a, auto const& b){
+                return a.value < b.value;
+            };
+            auto fMembers = first.enumMembers();
+            auto oMembers = other.enumMembers();
+            std::sort(std::begin(fMembers), std::end(fMembers), byValue);
+            std::sort(std::begin(oMembers), std::end(oMembers), byValue);
+            int size = fMembers.size();
+            if (size == oMembers.size())
+            {
+                for (int i = 0; i < size; ++i)
+                {
+                    if (fMembers[i] != oMembers[i])
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        }
+        break;
     case GenH5::DataTypeClass::Int: // not checking endianess etc.
-    case GenH5::DataTypeClass::Float: // not checking precision etc.
         return isSameSize;
+    case GenH5::DataTypeClass::Float: // not checking precision etc.
+        // distinguishes half precision types
+        return isSameSize &&
+               H5Tget_ebias(first.id()) == H5Tget_ebias(other.id());
     case GenH5::DataTypeClass::String:
         return isSameSize &&
                first.isVarString() == other.isVarString();
@@ -652,3 +1147,17 @@ operator!=(GenH5::CompoundMember const& first,
 {
     return !(first == other);
 }
+
+bool
+operator==(GenH5::EnumMember const& first,
+           GenH5::EnumMember const& other)
+{
+    return first.value == other.value &&
+           first.name == other.name;
+}
+bool
+operator!=(GenH5::EnumMember const& first,
+           GenH5::EnumMember const& other)
+{
+    return !(first == other);
+}
@@ -13,16 +13,22 @@
 #include "genh5_idcomponent.h"
 #include "genh5_object.h"
 #include "genh5_conversion/type.h"
+#include "genh5_float16.h"
 #include "genh5_typetraits.h"
 #include "genh5_version.h"
 #include "genh5_utils.h"
 
+#include <cstddef>
+#include <typeinfo>
+
 namespace GenH5
 {
 // forward decl
 struct CompoundMember;
+struct EnumMember;
 
 using CompoundMembers = Vector<CompoundMember>;
+using EnumMembers = Vector<EnumMember>;
 
 /**
  * @brief The DataType class
@@ -56,6 +62,10 @@ public:
 
     static DataType const& Float();
     static DataType const& Double();
+    /// IEEE 754 half precision (little endian)
+    static DataType const& Float16();
+    /// bfloat16, i.e. float with a mantissa of 7 bits (little endian)
+    static DataType const& BFloat16();
 
     static DataType const& VarString();
 
@@ -76,6 +86,10 @@ public:
     static DataType compound(size_t dataSize,
                              CompoundMembers const& members) noexcept(false);
 
+    /// will create an enum type based on the integer type `baseType`
+    static DataType enumeration(DataType const& baseType,
+                                EnumMembers const& members) noexcept(false);
+
     /// Instantiates a new Datatype and assigns the id without incrementing it
     static DataType fromId(hid_t id) noexcept;
 
@@ -144,6 +158,12 @@ public:
      */
     bool isCompound() const noexcept;
 
+    /**
+     * @brief whether this datatype is an enum type.
+     * @return true if is enum type
+     */
+    bool isEnum() const noexcept;
+
     /**
      * @brief  whether this datatype is a variable length datatype.
      * Will return false if type is var string.
@@ -169,6 +189,12 @@ public:
      */
     CompoundMembers compoundMembers() const noexcept(false);
 
+    /**
+     * @brief Returns the members (names and values) of the enum datatype.
+     * @return members. Empty if not an enum type
+     */
+    EnumMembers enumMembers() const noexcept(false);
+
     /**
      * @brief Returns the super datatype of this type. Used for accessing the
      * underlying type of an array or a varlen type.
@@ -176,6 +202,24 @@ public:
      */
     DataType superType() const noexcept(false);
 
+    /**
+     * @brief Returns a copy of this type without padding between compound
+     * members (also of nested compound types). Types that do not contain
+     * compound types are returned as is. Can be used as the datatype of a
+     * dataset, reading and writing may still use the aligned memory layout,
+     * HDF5 converts between both.
+     * @return packed datatype
+     */
+    DataType packed() const noexcept(false);
+
+    /**
+     * @brief Structural hash of this datatype. Types that are equal to each
+     * other have the same hash. The hash of interned types is precomputed,
+     * otherwise it is calculated recursively.
+     * @return hash
+     */
+    size_t hash() const noexcept(false);
+
     /// swaps all members
     void swap(DataType& other) noexcept;
 
@@ -185,6 +229,9 @@ protected:
     IdComponent<IdType::DataType> m_id;
 };
 
+/// borrowed reference to a datatype
+using DataTypeRef = ObjectRef<DataType>;
+
 struct CompoundMember
 {
     String name;
@@ -192,6 +239,12 @@ struct CompoundMember
     DataType type;
 };
 
+struct EnumMember
+{
+    String name;
+    qlonglong value;
+};
+
 /**
  * @brief Return the type names
  * @param dtype Datatype to extract compound members from
@@ -218,6 +271,76 @@ getTypeNames(DataType const& dtype) noexcept(false)
 namespace details
 {
 
+/**
+ * @brief Returns the datatype interned for the C++ type and member names.
+ * @param type C++ type
+ * @param names Member names (may be null)
+ * @param nNames Number of member names
+ * @return Interned datatype. Invalid if not interned yet.
+ */
+GENH5_EXPORT DataType findInternedDataType(std::type_info const& type,
+                                           String const* names,
+                                           size_t nNames) noexcept;
+
+/**
+ * @brief Interns the datatype for the C++ type and member names. The
+ * structural hash and a canonical id of the datatype are precomputed, thus
+ * interned types are compared in constant time. Interned types are never
+ * released, their ids are closed when the HDF5 library terminates. At most
+ * `maxInternedNamedDataTypes` types with member names are interned, further
+ * types are returned as is.
+ * @param type C++ type
+ * @param names Member names (may be null)
+ * @param nNames Number of member names
+ * @param dtype Datatype to intern
+ * @return Interned datatype. May differ from dtype if the type was interned
+ * concurrently.
+ */
+GENH5_EXPORT DataType internDataType(std::type_info const& type,
+                                     String const* names,
+                                     size_t nNames,
+                                     DataType dtype) noexcept(false);
+
+/// number of interned datatypes
+GENH5_EXPORT size_t internedDataTypeCount() noexcept;
+
+/// maximum number of interned datatypes with member names
+GENH5_EXPORT size_t maxInternedNamedDataTypes() noexcept;
+
+/**
+ * @brief Returns the interned datatype of T. The datatype is only created
+ * once using makeType, all subsequent calls return the interned instance.
+ * @param names Member names
+ * @param makeType Factory for creating the datatype
+ * @return Interned datatype
+ */
+template <typename T, size_t N, typename Factory>
+inline DataType
+internedDataType(CompoundNames<N> const& names, Factory makeType) noexcept(false)
+{
+    auto dtype = findInternedDataType(typeid(T), names.data(), N);
+    if (dtype.isValid()) return dtype;
+
+    return internDataType(typeid(T), names.data(), N, makeType());
+}
+
+/**
+ * @brief Overload for types without member names. The interned datatype is
+ * cached per C++ type, thus subsequent calls do not access the registry.
+ * @param makeType Factory for creating the datatype
+ * @return Interned datatype
+ */
+template <typename T, typename Factory>
+inline DataType
+internedDataType(CompoundNames<0> const& names, Factory makeType) noexcept(false)
+{
+    // never destroyed, the id is owned by the registry
+    static auto const* dtype = new DataType{
+        internDataType(typeid(T), names.data(), 0, makeType())
+    };
+    return *dtype;
+}
+
 // default specialization -> invalid datatype (compile timer error)
 template <typename T, typename ...Ts>
 struct datatype_impl
@@ -245,7 +368,9 @@ struct datatype_impl<Array<T, N>>
     datatype_impl(CompoundNames<0> = {}) {}
     operator DataType() const
     {
-        return GenH5::DataType::array(datatype_impl<T>(), N);
+        return internedDataType<Array<T, N>>(CompoundNames<0>{}, [](){
+            return GenH5::DataType::array(datatype_impl<T>(), N);
+        });
     }
 };
 
@@ -266,7 +391,9 @@ struct datatype_impl<VarLen<T>>
     datatype_impl(CompoundNames<0> = {}) {}
     operator DataType() const
     {
-        return GenH5::DataType::varLen(datatype_impl<T>());
+        return internedDataType<VarLen<T>>(CompoundNames<0>{}, [](){
+            return GenH5::DataType::varLen(datatype_impl<T>());
+        });
     }
 };
 
@@ -284,6 +411,19 @@ struct datatype_impl<Comp<Ts...>>
     }
 
     operator DataType() const
+    {
+        return internedDataType<Comp<Ts...>>(m_typeNames, [this](){
+            return makeCompound();
+        });
+    }
+
+private:
+    /// compound member for calculating offset of an element
+    static Compound m_t;
+    /// names for compound members
+    TypeNames m_typeNames{};
+
+    DataType makeCompound() const
     {
         CompoundMembers members;
         members.reserve(sizeof...(Ts));
@@ -302,12 +442,6 @@ struct datatype_impl<Comp<Ts...>>
         return DataType::compound(sizeof(Compound), members);
     }
 
-private:
-    /// compound member for calculating offset of an element
-    static Compound m_t;
-    /// names for compound members
-    TypeNames m_typeNames{};
-
     /// offset of tuple element
     template<size_t Idx>
     size_t offset() const
@@ -367,7 +501,7 @@ dataType() noexcept(false)
  * @brief operator == Compares two datatypes. Returns true if the two types
  * are similar to each other (e.g. same size, class type, super type, members
  * etc.). Some properties are not compared entirely (e.g. precision of floating
- * point types, endianess, signedness, enum values etc).
+ * point types, endianess, signedness etc).
  * @param first First
  * @param other Other
  * @return are types mostly equal
@@ -389,6 +523,18 @@ GENH5_EXPORT bool operator==(GenH5::CompoundMember const& first,
 GENH5_EXPORT bool operator!=(GenH5::CompoundMember const& first,
                              GenH5::CompoundMember const& other);
 
+/**
+ * @brief operator == Compares two enum members. Returns true if the two
+ * members are exactly the same (e.g. same name, same value).
+ * @param first First
+ * @param other Other
+ * @return equal
+ */
+GENH5_EXPORT bool operator==(GenH5::EnumMember const& first,
+                             GenH5::EnumMember const& other);
+GENH5_EXPORT bool operator!=(GenH5::EnumMember const& first,
+                             GenH5::EnumMember const& other);
+
 inline void
 swap(GenH5::DataType& a, GenH5::DataType& b) noexcept
 {
@@ -411,6 +557,46 @@ swap(GenH5::DataType& a, GenH5::DataType& b) noexcept
     inline \
     GenH5::details::datatype_impl<NATIVE_TYPE>::operator GenH5::DataType() const
 
+/**
+ * Registers a user defined struct as a compound type. The compound members
+ * are build using the offsets of the struct members, thus data of that type
+ * can be read and written directly without converting each element. The
+ * struct must be trivially copyable and have a standard layout. Members are
+ * listed using `GENH5_COMPOUND_MEMBER`. Must be used in the global namespace:
+ *
+ *  GENH5_DECLARE_COMPOUND_DATATYPE(Sample,
+ *                                  GENH5_COMPOUND_MEMBER(Sample, t),
+ *                                  GENH5_COMPOUND_MEMBER(Sample, id));
+ */
+#define GENH5_DECLARE_COMPOUND_DATATYPE(NATIVE_TYPE, ...) \
+    GENH5_DECLARE_DATATYPE_IMPL(NATIVE_TYPE) \
+    { \
+        static_assert(std::is_trivially_copyable<NATIVE_TYPE>::value && \
+                      std::is_standard_layout<NATIVE_TYPE>::value, \
+                      "Compound type must be trivially copyable and have " \
+                      "a standard layout!"); \
+        return GenH5::details::internedDataType<NATIVE_TYPE>( \
+                    GenH5::CompoundNames<0>{}, [](){ \
+            return GenH5::DataType::compound(sizeof(NATIVE_TYPE), \
+                                             { __VA_ARGS__ }); \
+        }); \
+    }
+
+/**
+ * Compound member of a struct registered using
+ * `GENH5_DECLARE_COMPOUND_DATATYPE`. The name of the member is used as the
+ * member name of the compound type, its type must be registered as well.
+ */
+#define GENH5_COMPOUND_MEMBER(NATIVE_TYPE, MEMBER) \
+    GENH5_COMPOUND_MEMBER_NAMED(NATIVE_TYPE, MEMBER, #MEMBER)
+
+// same as above but using a custom member name
+#define GENH5_COMPOUND_MEMBER_NAMED(NATIVE_TYPE, MEMBER, NAME) \
+    GenH5::CompoundMember{ \
+        NAME, offsetof(NATIVE_TYPE, MEMBER), \
+        GenH5::dataType<decltype(NATIVE_TYPE::MEMBER)>() \
+    }
+
 // default datatypes
 GENH5_DECLARE_DATATYPE(bool, DataType::Bool());
 
@@ -434,6 +620,9 @@ GENH5_DECLARE_DATATYPE(unsigned long long, DataType::ULLong());
 GENH5_DECLARE_DATATYPE(float, DataType::Float());
 GENH5_DECLARE_DATATYPE(double, DataType::Double());
 
+GENH5_DECLARE_DATATYPE(GenH5::float16, DataType::Float16());
+GENH5_DECLARE_DATATYPE(GenH5::bfloat16, DataType::BFloat16());
+
 GENH5_DECLARE_DATATYPE(GenH5::Version, DataType::Version());
 
 // fixed string
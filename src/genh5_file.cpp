@@ -8,6 +8,7 @@
  */
 
 #include "genh5_file.h"
+#include "genh5_datasetcproperties.h"
 #include "genh5_group.h"
 #include "genh5_private.h"
 
@@ -17,6 +18,178 @@
 #include "H5Fpublic.h"
 #include "H5Ppublic.h"
 
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace HandleCacheDataBase
+{
+
+/// location and name used to open an object
+struct Alias
+{
+    /// location id, holds one reference (i.e. the id cannot be reused)
+    GenH5::hid_t loc;
+    /// name relative to the location
+    GenH5::String name;
+
+    bool operator==(Alias const& other) const
+    {
+        return loc == other.loc && name == other.name;
+    }
+};
+
+struct AliasHash
+{
+    size_t operator()(Alias const& alias) const
+    {
+        return std::hash<GenH5::hid_t>{}(alias.loc) ^
+               (static_cast<size_t>(qHash(alias.name)) << 1);
+    }
+};
+
+/// cached object
+struct Entry
+{
+    /// path relative to the root group
+    GenH5::String path;
+    /// object id, holds one reference
+    GenH5::hid_t id;
+    /// locations and names the object was opened with
+    std::vector<Alias> aliases{};
+};
+
+struct Cache;
+
+using EntryIterator = std::list<Entry>::iterator;
+
+/// entries by location and name of all caches. Allows finding cached objects
+/// without resolving their path
+static std::unordered_map<Alias, std::pair<Cache*, EntryIterator>, AliasHash>&
+aliases()
+{
+    static std::unordered_map<Alias, std::pair<Cache*, EntryIterator>,
+                              AliasHash> aliases;
+    return aliases;
+}
+
+/// LRU cache of opened objects
+struct Cache
+{
+    Cache() = default;
+    Cache(Cache const&) = delete;
+    Cache& operator=(Cache const&) = delete;
+
+    ~Cache() { clear(); }
+
+    /// maximum number of entries
+    int capacity{};
+    /// entries, most recently used first
+    std::list<Entry> entries{};
+    /// entries by path
+    QHash<GenH5::String, EntryIterator> lookup{};
+
+    void addAlias(EntryIterator iter, GenH5::hid_t loc,
+                  GenH5::String const& name)
+    {
+        Alias alias{loc, name};
+        if (aliases().count(alias) > 0) return;
+        if (GenH5::incId(loc) <= 0) return;
+
+        aliases().insert({alias, {this, iter}});
+        iter->aliases.push_back(std::move(alias));
+    }
+
+    void releaseAliases(Entry& entry)
+    {
+        for (auto const& alias : entry.aliases)
+        {
+            aliases().erase(alias);
+            GenH5::decId(alias.loc);
+        }
+        entry.aliases.clear();
+    }
+
+    void erase(EntryIterator iter)
+    {
+        lookup.remove(iter->path);
+        releaseAliases(*iter);
+        GenH5::decId(iter->id);
+        entries.erase(iter);
+    }
+
+    void shrink()
+    {
+        while (static_cast<int>(entries.size()) > capacity)
+        {
+            erase(std::prev(entries.end()));
+        }
+    }
+
+    void clear()
+    {
+        for (auto& entry : entries)
+        {
+            releaseAliases(entry);
+            GenH5::decId(entry.id);
+        }
+        entries.clear();
+        lookup.clear();
+    }
+};
+
+using DataBase = std::unordered_map<GenH5::hid_t, Cache>;
+
+static DataBase& instance()
+{
+    static DataBase caches;
+    return caches;
+}
+
+static std::mutex& mutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+/// number of active caches, avoids locking if none are active
+static std::atomic<size_t>& count()
+{
+    static std::atomic<size_t> count{0};
+    return count;
+}
+
+/// mutex must be locked
+static Cache* find(GenH5::hid_t fileId)
+{
+    auto& dataBase = instance();
+    auto iter = dataBase.find(fileId);
+    return iter == dataBase.end() ? nullptr : &iter->second;
+}
+
+/// mutex must be locked
+static void remove(GenH5::hid_t fileId)
+{
+    auto& dataBase = instance();
+    dataBase.erase(fileId);
+    count() = dataBase.size();
+}
+
+/// clears the cache if the file object is the last one referencing the file
+static void release(GenH5::hid_t fileId)
+{
+    if (count() == 0 || fileId <= 0) return;
+
+    if (H5Iget_ref(fileId) != 1) return;
+
+    std::lock_guard<std::mutex> lock(mutex());
+    remove(fileId);
+}
+
+} // namespace HandleCacheDataBase
+
 GenH5::String
 GenH5::getFileName(File const& file) noexcept
 {
@@ -28,6 +201,37 @@ GenH5::getFileName(File const& file) noexcept
 
 GenH5::File::File() = default;
 
+GenH5::File
+GenH5::File::fromId(hid_t id) noexcept
+{
+    File f;
+    f.m_id = id;
+    return f;
+}
+
+GenH5::File::~File()
+{
+    HandleCacheDataBase::release(m_id.raw());
+}
+
+GenH5::File::File(File const& other) = default;
+GenH5::File::File(File&& other) = default;
+
+GenH5::File&
+GenH5::File::operator=(File const& other)
+{
+    File tmp{other};
+    swap(tmp);
+    return *this;
+}
+
+GenH5::File&
+GenH5::File::operator=(File&& other)
+{
+    swap(other);
+    return *this;
+}
+
 GenH5::File::File(hid_t id) :
     m_id(id)
 {
@@ -98,6 +302,10 @@ GenH5::File::File(String path, FileAccessFlags flags)
         }
     }
 
+    // datasets may use the built-in filters and conversions
+    registerBuiltinFilters();
+    registerBuiltinConversions();
+
     if (create)
     {
         m_id = H5Fcreate(path.constData(), flag, H5P_DEFAULT, H5P_DEFAULT);
@@ -181,10 +389,66 @@ GenH5::File::close()
     {
         m_root.close();
     }
+    HandleCacheDataBase::release(m_id.raw());
     m_id.dec();
     m_id = -2;
 }
 
+void
+GenH5::File::setHandleCacheCapacity(int capacity) noexcept(false)
+{
+    if (!isValid())
+    {
+        throw InvalidArgumentError{
+            GENH5_MAKE_EXECEPTION_STR() "Invalid file id"
+        };
+    }
+
+    std::lock_guard<std::mutex> lock(HandleCacheDataBase::mutex());
+
+    if (capacity <= 0)
+    {
+        HandleCacheDataBase::remove(m_id);
+        return;
+    }
+
+    auto& dataBase = HandleCacheDataBase::instance();
+    auto& cache = dataBase[m_id];
+    HandleCacheDataBase::count() = dataBase.size();
+
+    cache.capacity = capacity;
+    cache.shrink();
+}
+
+int
+GenH5::File::handleCacheCapacity() const noexcept
+{
+    std::lock_guard<std::mutex> lock(HandleCacheDataBase::mutex());
+
+    auto* cache = HandleCacheDataBase::find(m_id);
+    return cache ? cache->capacity : 0;
+}
+
+int
+GenH5::File::handleCacheSize() const noexcept
+{
+    std::lock_guard<std::mutex> lock(HandleCacheDataBase::mutex());
+
+    auto* cache = HandleCacheDataBase::find(m_id);
+    return cache ? static_cast<int>(cache->entries.size()) : 0;
+}
+
+void
+GenH5::File::clearHandleCache() noexcept
+{
+    std::lock_guard<std::mutex> lock(HandleCacheDataBase::mutex());
+
+    if (auto* cache = HandleCacheDataBase::find(m_id))
+    {
+        cache->clear();
+    }
+}
+
 void
 GenH5::File::swap(File& other) noexcept
 {
@@ -192,3 +456,138 @@ GenH5::File::swap(File& other) noexcept
     swap(m_id, other.m_id);
     swap(m_root, other.m_root);
 }
+
+GenH5::hid_t
+GenH5::details::findCachedHandle(hid_t locId,
+                                 String const& name,
+                                 IdType type) noexcept
+{
+    if (HandleCacheDataBase::count() == 0) return -1;
+
+    std::lock_guard<std::mutex> lock(HandleCacheDataBase::mutex());
+
+    auto& aliases = HandleCacheDataBase::aliases();
+    auto iter = aliases.find(HandleCacheDataBase::Alias{locId, name});
+    if (iter == aliases.end()) return -1;
+
+    auto* cache = iter->second.first;
+    auto entry = iter->second.second;
+    if (!isValidId(entry->id) || classType(entry->id) != type)
+    {
+        cache->erase(entry);
+        return -1;
+    }
+
+    // mark as most recently used
+    cache->entries.splice(cache->entries.begin(), cache->entries, entry);
+
+    incId(entry->id);
+    return entry->id;
+}
+
+GenH5::details::HandleCacheKey
+GenH5::details::handleCacheKey(hid_t locId, String const& name) noexcept
+{
+    if (HandleCacheDataBase::count() == 0) return {};
+
+    HandleCacheKey key;
+    key.file = IdComponent<IdType::File>{H5Iget_file_id(locId)};
+
+    {
+        std::lock_guard<std::mutex> lock(HandleCacheDataBase::mutex());
+        if (!HandleCacheDataBase::find(key.file)) return {};
+    }
+
+    key.loc = locId;
+    key.name = name;
+
+    // absolute paths are not relative to the location
+    if (name.startsWith('/'))
+    {
+        key.path = normalizedPath(name);
+        return key;
+    }
+
+    auto path = getName(locId, [](hid_t id, size_t len, char* data) {
+        return H5Iget_name(id, data, len);
+    });
+    key.path = normalizedPath(path + '/' + name);
+    return key;
+}
+
+GenH5::hid_t
+GenH5::details::findCachedHandle(HandleCacheKey const& key,
+                                 IdType type) noexcept
+{
+    if (!key.isValid()) return -1;
+
+    std::lock_guard<std::mutex> lock(HandleCacheDataBase::mutex());
+
+    auto* cache = HandleCacheDataBase::find(key.file);
+    if (!cache) return -1;
+
+    auto iter = cache->lookup.constFind(key.path);
+    if (iter == cache->lookup.constEnd()) return -1;
+
+    auto entry = iter.value();
+    if (!isValidId(entry->id) || classType(entry->id) != type)
+    {
+        cache->erase(entry);
+        return -1;
+    }
+
+    // mark as most recently used
+    cache->entries.splice(cache->entries.begin(), cache->entries, entry);
+    cache->addAlias(entry, key.loc, key.name);
+
+    incId(entry->id);
+    return entry->id;
+}
+
+void
+GenH5::details::cacheHandle(HandleCacheKey const& key, hid_t id) noexcept
+{
+    if (!key.isValid() || id <= 0) return;
+
+    std::lock_guard<std::mutex> lock(HandleCacheDataBase::mutex());
+
+    auto* cache = HandleCacheDataBase::find(key.file);
+    if (!cache) return;
+
+    auto iter = cache->lookup.constFind(key.path);
+    if (iter != cache->lookup.constEnd())
+    {
+        cache->erase(iter.value());
+    }
+
+    if (incId(id) <= 0) return;
+
+    cache->entries.push_front(HandleCacheDataBase::Entry{key.path, id});
+    cache->lookup.insert(key.path, cache->entries.begin());
+    cache->addAlias(cache->entries.begin(), key.loc, key.name);
+    cache->shrink();
+}
+
+void
+GenH5::details::removeCachedHandles(File const& file,
+                                    String const& path) noexcept
+{
+    if (HandleCacheDataBase::count() == 0) return;
+
+    std::lock_guard<std::mutex> lock(HandleCacheDataBase::mutex());
+
+    auto* cache = HandleCacheDataBase::find(file.id());
+    if (!cache) return;
+
+    auto key = normalizedPath(path);
+    auto childKey = key + '/';
+
+    for (auto iter = cache->entries.begin(); iter != cache->entries.end();)
+    {
+        auto current = iter++;
+        if (current->path == key || current->path.startsWith(childKey))
+        {
+            cache->erase(current);
+        }
+    }
+}
@@ -50,12 +50,26 @@ public:
      */
     static String dotFileSuffix() noexcept;
 
+    /**
+     * @brief Instantiates a file object from the id. Takes ownership of the
+     * id, thus the reference count is not incremented.
+     * @param id File id
+     * @return File
+     */
+    static File fromId(hid_t id) noexcept;
+
     /**
      * @brief File
      */
     File();
     explicit File(hid_t id);
     explicit File(String path, FileAccessFlags flags = ReadWrite);
+    ~File();
+
+    File(File const& other);
+    File(File&& other);
+    File& operator=(File const& other);
+    File& operator=(File&& other);
 
     /**
      * @brief id or handle of the hdf5 resource.
@@ -94,6 +108,37 @@ public:
      */
     void close();
 
+    /**
+     * @brief Enables the LRU cache of groups and datasets opened via
+     * `Group::openGroup` and `Group::openDataSet`. Opening a cached path
+     * again returns the cached object instead of resolving the path. Once
+     * opened, the object is found using the parent object and name only, the
+     * parent is kept open while the object is cached. The
+     * cache is shared by all file objects of the same file and entries are
+     * invalidated when deleting links. Cached objects keep the file open, thus
+     * the cache is cleared when the last file object is closed. A capacity of
+     * 0 disables the cache.
+     * @param capacity Maximum number of cached objects
+     */
+    void setHandleCacheCapacity(int capacity) noexcept(false);
+
+    /**
+     * @brief Capacity of the handle cache. 0 if the cache is disabled.
+     * @return capacity
+     */
+    int handleCacheCapacity() const noexcept;
+
+    /**
+     * @brief Number of objects in the handle cache.
+     * @return size
+     */
+    int handleCacheSize() const noexcept;
+
+    /**
+     * @brief Closes all objects in the handle cache. The capacity is kept.
+     */
+    void clearHandleCache() noexcept;
+
     /// swaps all members
     void swap(File& other) noexcept;
 
@@ -105,8 +150,56 @@ private:
     mutable Group m_root{};
 };
 
+/// borrowed reference to a file
+using FileRef = ObjectRef<File>;
+
 GENH5_EXPORT GenH5::String getFileName(File const& file) noexcept;
 
+namespace details
+{
+
+/// key of an object in the handle cache of its file
+struct HandleCacheKey
+{
+    /// file with an active handle cache
+    IdComponent<IdType::File> file{};
+    /// path relative to the root group
+    String path{};
+    /// location and name used to open the object
+    hid_t loc{-1};
+    String name{};
+
+    bool isValid() const noexcept { return file.raw() > 0; }
+};
+
+/// returns the object cached for the location and name without resolving its
+/// path. The id is incremented and must be closed by the caller. Returns an
+/// invalid id if none is cached.
+GENH5_EXPORT hid_t findCachedHandle(hid_t locId,
+                                    String const& name,
+                                    IdType type) noexcept;
+
+/// key of the object name relative to the location. Invalid if the handle
+/// cache of the file is disabled. Resolves the path of the location.
+GENH5_EXPORT HandleCacheKey handleCacheKey(hid_t locId,
+                                           String const& name) noexcept;
+
+/// returns the cached object of the type specified, the id is incremented and
+/// must be closed by the caller. Returns an invalid id if none is cached.
+/// Subsequent lookups using the location and name of the key will not
+/// resolve the path.
+GENH5_EXPORT hid_t findCachedHandle(HandleCacheKey const& key,
+                                    IdType type) noexcept;
+
+/// adds the object to the handle cache
+GENH5_EXPORT void cacheHandle(HandleCacheKey const& key, hid_t id) noexcept;
+
+/// removes the path and all child paths from the handle cache of the file
+GENH5_EXPORT void removeCachedHandles(File const& file,
+                                      String const& path) noexcept;
+
+} // namespace details
+
 } // namespace GenH5
 
 inline void
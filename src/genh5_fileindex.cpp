@@ -0,0 +1,519 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#include "genh5_fileindex.h"
+#include "genh5_private.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace FileIndexDataBase
+{
+
+using DataBase = std::unordered_map<GenH5::hid_t,
+                                    std::shared_ptr<GenH5::FileIndex>>;
+
+static DataBase& instance()
+{
+    static DataBase indices;
+    return indices;
+}
+
+static std::shared_mutex& mutex()
+{
+    static std::shared_mutex mutex;
+    return mutex;
+}
+
+/// number of registered indices, avoids locking if none are registered
+static std::atomic<size_t>& count()
+{
+    static std::atomic<size_t> count{0};
+    return count;
+}
+
+} // namespace FileIndexDataBase
+
+namespace
+{
+
+/// token is stored as two 64 bit integers in the sidecar dataset
+using SidecarToken = GenH5::Array<unsigned long long, 2>;
+using SidecarData  = GenH5::CompData<GenH5::String, int, SidecarToken>;
+
+static_assert(sizeof(SidecarToken) == GenH5::details::token_size,
+              "Token size does not match sidecar token size");
+
+template <typename Tobject>
+inline Tobject
+openByToken(GenH5::hid_t fileId,
+            GenH5::NodeInfo const& info,
+            GenH5::IdType type,
+            std::string const& msg) noexcept(false)
+{
+    if (info.type != type)
+    {
+        throw GenH5::LocationException{
+            GENH5_MAKE_EXECEPTION_STR() + msg + " (invalid object type)"
+        };
+    }
+
+    H5O_token_t token;
+    std::memcpy(token.__data, info.token.__data, sizeof(token.__data));
+
+    hid_t id = H5Oopen_by_token(fileId, token);
+    if (id < 0)
+    {
+        throw GenH5::LocationException{
+            GENH5_MAKE_EXECEPTION_STR() + msg + " (invalid token)"
+        };
+    }
+
+    auto cleanup = GenH5::finally(H5Oclose, id);
+    Q_UNUSED(cleanup)
+
+    return Tobject{id};
+}
+
+/// compares the token of an object with the indexed token
+inline bool
+isSameToken(GenH5::hid_t fileId,
+            H5O_token_t const& token,
+            GenH5::token_t const& indexed) noexcept
+{
+    H5O_token_t other;
+    std::memcpy(other.__data, indexed.__data, sizeof(other.__data));
+
+    int cmp = 0;
+    return H5Otoken_cmp(fileId, &token, &other, &cmp) >= 0 && cmp == 0;
+}
+
+/// returns whether the link is a hard link, i.e. whether it may be indexed
+inline bool
+isHardLink(GenH5::hid_t fileId, GenH5::String const& path) noexcept
+{
+    H5L_info_t linkInfo{};
+    return H5Lget_info(fileId, path.constData(), &linkInfo, H5P_DEFAULT) >= 0 &&
+           linkInfo.type == H5L_TYPE_HARD;
+}
+
+/// counts the hard links to groups and datasets, i.e. the links of a group
+/// that are indexed
+herr_t
+countIndexedLinks(GenH5::hid_t groupId, char const* linkName,
+                  H5L_info_t const* linkInfo, void* dataPtr)
+{
+    assert(linkInfo);
+    assert(dataPtr);
+
+    if (linkInfo->type != H5L_TYPE_HARD) return 0;
+
+    H5O_info2_t objInfo{};
+    if (H5Oget_info_by_name3(groupId, linkName, &objInfo,
+                             H5O_INFO_BASIC, H5P_DEFAULT) < 0)
+    {
+        return -1;
+    }
+
+    auto type = GenH5::alg::toIdType(objInfo.type);
+    if (type == GenH5::IdType::Group || type == GenH5::IdType::DataSet)
+    {
+        ++*static_cast<hsize_t*>(dataPtr);
+    }
+    return 0;
+}
+
+} // namespace
+
+GenH5::String
+GenH5::FileIndex::sidecarName() noexcept
+{
+    return QByteArrayLiteral(".genh5_index");
+}
+
+GenH5::FileIndex
+GenH5::FileIndex::load(File const& file) noexcept(false)
+{
+    if (!file.isValid())
+    {
+        throw InvalidArgumentError{
+            GENH5_MAKE_EXECEPTION_STR() "Loading file index failed "
+            "(invalid file)"
+        };
+    }
+
+    FileIndex index;
+    index.m_fileId = file.id();
+
+    if (!file.root().exists(sidecarName())) return index;
+
+    auto data = file.root().readDataSet<String, int, SidecarToken>(
+                sidecarName());
+
+    auto const& paths  = data.getValues<0>();
+    auto const& types  = data.getValues<1>();
+    auto const& tokens = data.getValues<2>();
+
+    index.m_nodes.reserve(paths.size());
+    for (int i = 0; i < paths.size(); ++i)
+    {
+        NodeInfo info;
+        info.path = paths[i];
+        info.type = static_cast<IdType>(types[i]);
+        std::memcpy(info.token.__data, tokens[i].data(),
+                    sizeof(info.token.__data));
+        index.m_nodes.insert(info.path, std::move(info));
+    }
+
+    return index;
+}
+
+GenH5::FileIndex::FileIndex() = default;
+
+GenH5::FileIndex::FileIndex(File const& file) noexcept(false)
+{
+    if (!file.isValid())
+    {
+        throw InvalidArgumentError{
+            GENH5_MAKE_EXECEPTION_STR() "Building file index failed "
+            "(invalid file)"
+        };
+    }
+
+    m_fileId = file.id();
+
+    auto const sidecar = sidecarName();
+    for (auto const& info : file.root().children(FindRecursive))
+    {
+        if (info.path == sidecar) continue;
+        if (!info.isGroup() && !info.isDataSet()) continue;
+        // soft and external links may refer to any object
+        if (!isHardLink(m_fileId, info.path)) continue;
+
+        m_nodes.insert(info.path, info);
+    }
+}
+
+bool
+GenH5::FileIndex::isValid() const noexcept
+{
+    return isValidId(m_fileId) && classType(m_fileId) == IdType::File;
+}
+
+bool
+GenH5::FileIndex::contains(String const& path) const noexcept
+{
+    return m_nodes.contains(details::normalizedPath(path));
+}
+
+GenH5::IdType
+GenH5::FileIndex::type(String const& path) const noexcept
+{
+    auto iter = m_nodes.constFind(details::normalizedPath(path));
+    return iter == m_nodes.constEnd() ? IdType::BadId : iter.value().type;
+}
+
+GenH5::NodeInfo
+GenH5::FileIndex::nodeInfo(String const& path) const noexcept(false)
+{
+    auto iter = m_nodes.constFind(details::normalizedPath(path));
+    if (iter == m_nodes.constEnd())
+    {
+        throw LocationException{
+            GENH5_MAKE_EXECEPTION_STR() "Path '" + path.toStdString() +
+            "' is not indexed"
+        };
+    }
+    return iter.value();
+}
+
+GenH5::DataSet
+GenH5::FileIndex::openDataSet(String const& path) const noexcept(false)
+{
+    std::string msg = "Opening dataset '" + path.toStdString() + "' failed";
+    if (!isValid())
+    {
+        throw DataSetException{
+            GENH5_MAKE_EXECEPTION_STR() + msg + " (invalid file)"
+        };
+    }
+
+    return openByToken<DataSet>(m_fileId, nodeInfo(path),
+                                IdType::DataSet, msg);
+}
+
+GenH5::Group
+GenH5::FileIndex::openGroup(String const& path) const noexcept(false)
+{
+    std::string msg = "Opening group '" + path.toStdString() + "' failed";
+    if (!isValid())
+    {
+        throw GroupException{
+            GENH5_MAKE_EXECEPTION_STR() + msg + " (invalid file)"
+        };
+    }
+
+    return openByToken<Group>(m_fileId, nodeInfo(path),
+                              IdType::Group, msg);
+}
+
+void
+GenH5::FileIndex::insert(NodeInfo info) noexcept
+{
+    info.path = details::normalizedPath(std::move(info.path));
+    if (info.path.isEmpty() || info.path == sidecarName()) return;
+
+    m_nodes.insert(info.path, std::move(info));
+}
+
+int
+GenH5::FileIndex::remove(String const& path) noexcept
+{
+    auto key = details::normalizedPath(path);
+
+    auto iter = m_nodes.constFind(key);
+    if (iter == m_nodes.constEnd()) return 0;
+
+    bool const isGroup = iter.value().isGroup();
+    int count = m_nodes.remove(key);
+
+    // only groups have child nodes
+    if (!isGroup) return count;
+
+    key += '/';
+    Vector<String> children;
+    for (auto iter = m_nodes.constBegin(); iter != m_nodes.constEnd(); ++iter)
+    {
+        if (iter.key().startsWith(key)) children.push_back(iter.key());
+    }
+    for (auto const& child : qAsConst(children))
+    {
+        count += m_nodes.remove(child);
+    }
+
+    return count;
+}
+
+void
+GenH5::FileIndex::clear() noexcept
+{
+    m_nodes.clear();
+}
+
+bool
+GenH5::FileIndex::verify() const noexcept
+{
+    if (!isValid()) return false;
+
+    // number of indexed child nodes by group path ("" is the root group)
+    QHash<String, hsize_t> nChildren;
+    nChildren.insert(String{}, 0);
+
+    for (auto iter = m_nodes.constBegin(); iter != m_nodes.constEnd(); ++iter)
+    {
+        auto const& path = iter.key();
+        auto const& info = iter.value();
+
+        // path must still refer to the same object
+        H5O_info2_t objInfo{};
+        if (H5Oget_info_by_name3(m_fileId, path.constData(), &objInfo,
+                                 H5O_INFO_BASIC, H5P_DEFAULT) < 0 ||
+            alg::toIdType(objInfo.type) != info.type ||
+            !isSameToken(m_fileId, objInfo.token, info.token))
+        {
+            return false;
+        }
+
+        if (info.isGroup()) nChildren[path];
+
+        int idx = path.lastIndexOf('/');
+        ++nChildren[idx < 0 ? String{} : path.left(idx)];
+    }
+
+    // no groups or datasets must have been added. Other links (e.g. soft
+    // links or committed datatypes) are not indexed and thus ignored
+    for (auto iter = nChildren.constBegin(); iter != nChildren.constEnd();
+         ++iter)
+    {
+        bool const isRoot = iter.key().isEmpty();
+
+        hsize_t nLinks = 0;
+        if (H5Literate_by_name(m_fileId,
+                               isRoot ? "." : iter.key().constData(),
+                               H5_INDEX_NAME, H5_ITER_NATIVE, nullptr,
+                               countIndexedLinks, &nLinks, H5P_DEFAULT) < 0)
+        {
+            return false;
+        }
+
+        hsize_t expected = iter.value();
+        // sidecar is not indexed
+        if (isRoot && H5Lexists(m_fileId, sidecarName().constData(),
+                                H5P_DEFAULT) > 0)
+        {
+            ++expected;
+        }
+
+        if (nLinks != expected) return false;
+    }
+
+    return true;
+}
+
+bool
+GenH5::FileIndex::save() const noexcept(false)
+{
+    if (!isValid())
+    {
+        log::ErrStream()
+                << GENH5_MAKE_EXECEPTION_STR()
+                   "Saving file index failed (invalid file)";
+        return false;
+    }
+
+    SidecarData data{{"path", "type", "token"}};
+    data.reserve(m_nodes.size());
+
+    for (auto const& info : m_nodes)
+    {
+        SidecarToken token;
+        std::memcpy(token.data(), info.token.__data, sizeof(token));
+        data.push_back(info.path, static_cast<int>(info.type), token);
+    }
+
+    File file{m_fileId};
+    auto& root = file.root();
+
+    // the number of nodes may have changed
+    if (root.exists(sidecarName()))
+    {
+        root.openDataSet(sidecarName()).deleteLink();
+    }
+
+    return root.writeDataSet(sidecarName(), data).isValid();
+}
+
+std::shared_ptr<GenH5::FileIndex>
+GenH5::registerFileIndex(File const& file, bool useSidecar) noexcept(false)
+{
+    if (!file.isValid())
+    {
+        throw InvalidArgumentError{
+            GENH5_MAKE_EXECEPTION_STR() "Invalid file id"
+        };
+    }
+
+    std::shared_ptr<FileIndex> index;
+    if (useSidecar && file.root().exists(FileIndex::sidecarName()))
+    {
+        index = std::make_shared<FileIndex>(FileIndex::load(file));
+
+        // the file may have been changed without updating the sidecar
+        if (!index->verify()) index.reset();
+    }
+
+    if (!index)
+    {
+        index = std::make_shared<FileIndex>(file);
+    }
+
+    auto& mutex = FileIndexDataBase::mutex();
+    std::unique_lock<std::shared_mutex> lock(mutex);
+
+    auto& dataBase = FileIndexDataBase::instance();
+    dataBase[file.id()] = index;
+    FileIndexDataBase::count() = dataBase.size();
+
+    return index;
+}
+
+std::shared_ptr<GenH5::FileIndex>
+GenH5::findFileIndex(File const& file) noexcept
+{
+    if (FileIndexDataBase::count() == 0) return {};
+
+    auto& mutex = FileIndexDataBase::mutex();
+    std::shared_lock<std::shared_mutex> lock(mutex);
+
+    auto& dataBase = FileIndexDataBase::instance();
+    auto iter = dataBase.find(file.id());
+    if (iter == dataBase.end()) return {};
+
+    return iter->second;
+}
+
+bool
+GenH5::clearFileIndex(File const& file) noexcept
+{
+    auto& mutex = FileIndexDataBase::mutex();
+    std::unique_lock<std::shared_mutex> lock(mutex);
+
+    auto& dataBase = FileIndexDataBase::instance();
+    bool success = dataBase.erase(file.id()) > 0;
+    FileIndexDataBase::count() = dataBase.size();
+
+    return success;
+}
+
+void
+GenH5::details::fileIndexInsert(Location const& location) noexcept
+{
+    if (FileIndexDataBase::count() == 0) return;
+
+    auto index = findFileIndex(location.file());
+    if (!index) return;
+
+    H5O_info2_t objInfo{};
+    if (H5Oget_info3(location.id(), &objInfo, H5O_INFO_BASIC) < 0) return;
+
+    NodeInfo info;
+    info.path = location.path();
+    info.type = alg::toIdType(objInfo.type);
+    std::memcpy(info.token.__data, objInfo.token.__data,
+                sizeof(info.token.__data));
+
+    index->insert(std::move(info));
+}
+
+void
+GenH5::details::fileIndexRemove(File const& file, String path) noexcept
+{
+    if (FileIndexDataBase::count() == 0) return;
+
+    if (auto index = findFileIndex(file))
+    {
+        index->remove(path);
+    }
+}
+
+bool
+GenH5::details::hasFileIndices() noexcept
+{
+    return FileIndexDataBase::count() > 0;
+}
+
+void
+GenH5::details::clearFileIndex(hid_t fileId) noexcept
+{
+    auto& mutex = FileIndexDataBase::mutex();
+    std::unique_lock<std::shared_mutex> lock(mutex);
+
+    auto& dataBase = FileIndexDataBase::instance();
+    auto iter = dataBase.find(fileId);
+    if (iter == dataBase.end()) return;
+
+    // the id may be reused by another file
+    iter->second->m_fileId = -1;
+
+    dataBase.erase(iter);
+    FileIndexDataBase::count() = dataBase.size();
+}
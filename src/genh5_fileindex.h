@@ -0,0 +1,220 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#ifndef GENH5_FILEINDEX_H
+#define GENH5_FILEINDEX_H
+
+#include "genh5_file.h"
+
+#include <QHash>
+
+#include <memory>
+
+namespace GenH5
+{
+
+namespace details { GENH5_EXPORT void clearFileIndex(hid_t fileId) noexcept; }
+
+/**
+ * @brief The FileIndex class. Maps the path of each group and dataset of a
+ * file onto its object token and type. The index is built in a single
+ * traversal of the file, afterwards resolving a path is a hash lookup and
+ * the object is opened using its token instead of walking the path.
+ * Paths are relative to the root group (e.g. "group/dataset").
+ * Once registered using `registerFileIndex` the index is updated when
+ * creating groups and datasets and when deleting links. The index may be
+ * saved to a sidecar dataset in the root group of the file and loaded
+ * again when reopening the file. The sidecar is not updated automatically.
+ * The index does not keep the file open.
+ */
+class GENH5_EXPORT FileIndex
+{
+public:
+
+    /**
+     * @brief Name of the sidecar dataset in the root group.
+     * @return sidecar name
+     */
+    static String sidecarName() noexcept;
+
+    /**
+     * @brief Loads the index from the sidecar dataset of the file. Returns
+     * an empty index if the file has no sidecar dataset.
+     * @param file File
+     * @return File index
+     */
+    static FileIndex load(File const& file) noexcept(false);
+
+    FileIndex();
+
+    /**
+     * @brief Builds the index by traversing all groups and datasets of the
+     * file. The sidecar dataset is not indexed.
+     * @param file File to index
+     */
+    explicit FileIndex(File const& file) noexcept(false);
+
+    /**
+     * @brief Whether the index belongs to a file that is still open.
+     * @return is valid
+     */
+    bool isValid() const noexcept;
+
+    /**
+     * @brief Number of indexed nodes.
+     * @return size
+     */
+    int size() const noexcept { return m_nodes.size(); }
+    bool isEmpty() const noexcept { return m_nodes.isEmpty(); }
+
+    /**
+     * @brief Whether the path is indexed.
+     * @param path Path relative to the root group
+     * @return contains path
+     */
+    bool contains(String const& path) const noexcept;
+
+    /**
+     * @brief Type of the node at path.
+     * @param path Path relative to the root group
+     * @return Object type, `IdType::BadId` if the path is not indexed
+     */
+    IdType type(String const& path) const noexcept;
+
+    /**
+     * @brief Info struct of the node at path. The path of the info struct is
+     * relative to the root group. Throws if the path is not indexed.
+     * @param path Path relative to the root group
+     * @return Node info
+     */
+    NodeInfo nodeInfo(String const& path) const noexcept(false);
+
+    /**
+     * @brief Opens the dataset at path using its token. Throws if the path
+     * is not indexed or is not a dataset.
+     * @param path Path relative to the root group
+     * @return Dataset
+     */
+    DataSet openDataSet(String const& path) const noexcept(false);
+
+    /**
+     * @brief Opens the group at path using its token. Throws if the path
+     * is not indexed or is not a group.
+     * @param path Path relative to the root group
+     * @return Group
+     */
+    Group openGroup(String const& path) const noexcept(false);
+
+    /**
+     * @brief Inserts or updates the node. The path of the info struct must be
+     * relative to the root group.
+     * @param info Node info
+     */
+    void insert(NodeInfo info) noexcept;
+
+    /**
+     * @brief Removes the node at path and all of its child nodes. Removing
+     * a group requires iterating over all indexed nodes, removing a dataset
+     * does not.
+     * @param path Path relative to the root group
+     * @return Number of nodes removed
+     */
+    int remove(String const& path) noexcept;
+
+    /**
+     * @brief Clears the index.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Checks whether the index still matches the file, i.e. each
+     * indexed path refers to the same object and no groups or datasets were
+     * added to the root group or any indexed group. Soft and external links
+     * are not indexed and thus ignored. Requires accessing the object header
+     * of each indexed node and its links, but does not traverse the file.
+     * Should be used before trusting an index loaded from the sidecar
+     * dataset, since the sidecar is not updated when the file is changed
+     * without the index.
+     * @return Whether the index matches the file
+     */
+    bool verify() const noexcept;
+
+    /**
+     * @brief Writes the index to the sidecar dataset of the file,
+     * overwriting an existing sidecar.
+     * @return success
+     */
+    bool save() const noexcept(false);
+
+private:
+
+    /// file id, not owned. Reset when the file is closed while the index is
+    /// registered
+    hid_t m_fileId{-1};
+
+    friend void details::clearFileIndex(hid_t fileId) noexcept;
+    /// nodes by path
+    QHash<String, NodeInfo> m_nodes{};
+};
+
+/**
+ * @brief Builds the index of `file` and registers it. If `useSidecar` is
+ * true the index is loaded from the sidecar dataset instead, as long as the
+ * sidecar exists and still matches the file (see `FileIndex::verify`). The
+ * registered index is updated when creating groups and datasets and when
+ * deleting links in the file. The index is unregistered and invalidated
+ * when the file is closed.
+ * @throws InvalidArgumentError if `file` is not a valid file.
+ * @param file File object
+ * @param useSidecar Whether to load the index from the sidecar dataset
+ * @return Registered file index
+ */
+GENH5_EXPORT
+std::shared_ptr<FileIndex> registerFileIndex(File const& file,
+                                             bool useSidecar = false
+                                             ) noexcept(false);
+
+/**
+ * @brief Attempts to find the index registered for `file`.
+ * @param file File object
+ * @return File index (may be null)
+ */
+GENH5_NODISCARD
+GENH5_EXPORT
+std::shared_ptr<FileIndex> findFileIndex(File const& file) noexcept;
+
+/**
+ * @brief Unregisters the index of `file`.
+ * @param file File object
+ * @return Success (if an index was registered)
+ */
+GENH5_EXPORT
+bool clearFileIndex(File const& file) noexcept;
+
+namespace details
+{
+
+/// adds the location to the index registered for its file (if any)
+GENH5_EXPORT void fileIndexInsert(Location const& location) noexcept;
+
+/// removes the path from the index registered for the file (if any)
+GENH5_EXPORT void fileIndexRemove(File const& file, String path) noexcept;
+
+/// whether any file index is registered
+GENH5_EXPORT bool hasFileIndices() noexcept;
+
+/// unregisters and invalidates the index of the file (if any). Is called
+/// when the last handle of the file is closed, since file ids may be reused
+GENH5_EXPORT void clearFileIndex(hid_t fileId) noexcept;
+
+} // namespace details
+
+} // namespace GenH5
+
+#endif // GENH5_FILEINDEX_H
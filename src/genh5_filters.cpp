@@ -0,0 +1,278 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#include "genh5_datasetcproperties.h"
+#include "genh5_logging.h"
+
+#include <H5public.h>
+#include <H5Zpublic.h>
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+#ifdef GENH5_HAVE_LZ4
+#include <lz4.h>
+#endif
+
+#ifdef GENH5_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+namespace
+{
+
+/// filter names as used by the registered HDF5 plugins
+constexpr char const* s_lz4Name  = "HDF5 lz4 filter; see http://www.hdfgroup.org/services/contributions.html";
+constexpr char const* s_zstdName = "Zstandard compression: http://www.zstd.net";
+
+/// writes a big endian integer (format of the lz4 plugin)
+template <typename T>
+inline void
+writeBigEndian(char* dst, T value)
+{
+    for (size_t i = 0; i < sizeof(T); ++i)
+    {
+        dst[i] = static_cast<char>((value >> (8 * (sizeof(T) - 1 - i))) & 0xff);
+    }
+}
+
+/// reads a big endian integer (format of the lz4 plugin)
+template <typename T>
+inline T
+readBigEndian(char const* src)
+{
+    T value{0};
+    for (size_t i = 0; i < sizeof(T); ++i)
+    {
+        value = static_cast<T>((value << 8) |
+                               static_cast<unsigned char>(src[i]));
+    }
+    return value;
+}
+
+/// replaces the buffer of the filter, returns the number of valid bytes
+inline size_t
+replaceBuffer(void* out, size_t outSize, size_t bufSize,
+              size_t* buf_size, void** buf)
+{
+    H5free_memory(*buf);
+    *buf = out;
+    *buf_size = bufSize;
+    return outSize;
+}
+
+#ifdef GENH5_HAVE_LZ4
+
+/// default block size of the lz4 plugin
+constexpr size_t s_lz4DefaultBlockSize = size_t{1} << 30;
+
+/**
+ * Lz4 filter, compatible with the registered lz4 plugin (32004). The data is
+ * split into blocks that are compressed individually. Layout:
+ * original size (8 bytes), block size (4 bytes), then for each block the
+ * compressed size (4 bytes) followed by the compressed data. Blocks that do
+ * not compress are stored as is.
+ */
+size_t
+lz4Filter(unsigned flags, size_t cd_nelmts, unsigned const cd_values[],
+          size_t nbytes, size_t* buf_size, void** buf)
+{
+    constexpr size_t headerSize = 12;
+    char const* src = static_cast<char const*>(*buf);
+
+    if (flags & H5Z_FLAG_REVERSE)
+    {
+        if (nbytes < headerSize) return 0;
+
+        auto const origSize = readBigEndian<uint64_t>(src);
+        size_t blockSize = readBigEndian<uint32_t>(src + 8);
+        if (blockSize == 0 && origSize > 0) return 0;
+
+        char* out = static_cast<char*>(H5allocate_memory(origSize, false));
+        if (!out) return 0;
+
+        char const* rpos = src + headerSize;
+        char const* const rend = src + nbytes;
+        size_t decompressed = 0;
+
+        while (decompressed < origSize)
+        {
+            blockSize = std::min<size_t>(blockSize, origSize - decompressed);
+            if (rend - rpos < 4)
+            {
+                H5free_memory(out);
+                return 0;
+            }
+
+            auto const compSize = readBigEndian<uint32_t>(rpos);
+            rpos += 4;
+            if (static_cast<size_t>(rend - rpos) < compSize)
+            {
+                H5free_memory(out);
+                return 0;
+            }
+
+            // block was stored uncompressed
+            if (compSize == blockSize)
+            {
+                std::memcpy(out + decompressed, rpos, blockSize);
+            }
+            else if (LZ4_decompress_safe(rpos, out + decompressed,
+                                         static_cast<int>(compSize),
+                                         static_cast<int>(blockSize)) !=
+                     static_cast<int>(blockSize))
+            {
+                H5free_memory(out);
+                return 0;
+            }
+
+            rpos += compSize;
+            decompressed += blockSize;
+        }
+
+        return replaceBuffer(out, origSize, origSize, buf_size, buf);
+    }
+
+    size_t blockSize = (cd_nelmts > 0 && cd_values[0] > 0) ?
+                           cd_values[0] : s_lz4DefaultBlockSize;
+    blockSize = std::max<size_t>(std::min(blockSize, nbytes), 1);
+
+    size_t const nBlocks = (nbytes + blockSize - 1) / blockSize;
+    size_t const bound = static_cast<size_t>(
+                LZ4_compressBound(static_cast<int>(blockSize)));
+    size_t const outBufSize = headerSize + nBlocks * (4 + bound);
+
+    char* out = static_cast<char*>(H5allocate_memory(outBufSize, false));
+    if (!out) return 0;
+
+    writeBigEndian<uint64_t>(out, nbytes);
+    writeBigEndian<uint32_t>(out + 8, static_cast<uint32_t>(blockSize));
+
+    char* wpos = out + headerSize;
+    size_t compressed = 0;
+
+    while (compressed < nbytes)
+    {
+        size_t const size = std::min(blockSize, nbytes - compressed);
+
+        int compSize = LZ4_compress_default(src + compressed, wpos + 4,
+                                            static_cast<int>(size),
+                                            static_cast<int>(bound));
+        // store incompressible blocks as is
+        if (compSize <= 0 || static_cast<size_t>(compSize) >= size)
+        {
+            std::memcpy(wpos + 4, src + compressed, size);
+            compSize = static_cast<int>(size);
+        }
+
+        writeBigEndian<uint32_t>(wpos, static_cast<uint32_t>(compSize));
+        wpos += 4 + compSize;
+        compressed += size;
+    }
+
+    return replaceBuffer(out, wpos - out, outBufSize, buf_size, buf);
+}
+
+#endif
+
+#ifdef GENH5_HAVE_ZSTD
+
+/**
+ * Zstandard filter, compatible with the registered zstd plugin (32015). The
+ * data is stored as a single zstd frame. The first parameter is the
+ * compression level.
+ */
+size_t
+zstdFilter(unsigned flags, size_t cd_nelmts, unsigned const cd_values[],
+           size_t nbytes, size_t* buf_size, void** buf)
+{
+    if (flags & H5Z_FLAG_REVERSE)
+    {
+        auto const origSize = ZSTD_getFrameContentSize(*buf, nbytes);
+        if (origSize == ZSTD_CONTENTSIZE_UNKNOWN ||
+            origSize == ZSTD_CONTENTSIZE_ERROR)
+        {
+            return 0;
+        }
+
+        void* out = H5allocate_memory(origSize, false);
+        if (!out) return 0;
+
+        size_t const size = ZSTD_decompress(out, origSize, *buf, nbytes);
+        if (ZSTD_isError(size))
+        {
+            H5free_memory(out);
+            return 0;
+        }
+
+        return replaceBuffer(out, size, origSize, buf_size, buf);
+    }
+
+    int const level = cd_nelmts > 0 ? static_cast<int>(cd_values[0]) : 3;
+
+    size_t const outBufSize = ZSTD_compressBound(nbytes);
+    void* out = H5allocate_memory(outBufSize, false);
+    if (!out) return 0;
+
+    size_t const size = ZSTD_compress(out, outBufSize, *buf, nbytes, level);
+    if (ZSTD_isError(size))
+    {
+        H5free_memory(out);
+        return 0;
+    }
+
+    return replaceBuffer(out, size, outBufSize, buf_size, buf);
+}
+
+#endif
+
+/// registers the filter, returns false on failure
+inline bool
+registerFilter(int id, char const* name, H5Z_func_t func)
+{
+    H5Z_class2_t filterClass{};
+    filterClass.version = H5Z_CLASS_T_VERS;
+    filterClass.id = static_cast<H5Z_filter_t>(id);
+    filterClass.encoder_present = 1;
+    filterClass.decoder_present = 1;
+    filterClass.name = name;
+    filterClass.filter = func;
+
+    if (H5Zregister(&filterClass) < 0)
+    {
+        GenH5::log::ErrStream()
+                << GENH5_MAKE_EXECEPTION_STR()
+                   "Registering filter failed: " << id;
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+bool
+GenH5::registerBuiltinFilters() noexcept
+{
+    static bool success = true;
+    static std::once_flag flag;
+
+    std::call_once(flag, [](){
+#ifdef GENH5_HAVE_LZ4
+        success &= registerFilter(FilterLz4, s_lz4Name, lz4Filter);
+#endif
+#ifdef GENH5_HAVE_ZSTD
+        success &= registerFilter(FilterZstd, s_zstdName, zstdFilter);
+#endif
+        Q_UNUSED(s_lz4Name)
+        Q_UNUSED(s_zstdName)
+    });
+
+    return success;
+}
@@ -0,0 +1,228 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#include "genh5_float16.h"
+#include "genh5_datatype.h"
+#include "genh5_logging.h"
+#include "genh5_exception.h"
+#include "genh5_simd.h"
+
+#include <H5Tpublic.h>
+
+#include <algorithm>
+#include <mutex>
+
+namespace
+{
+
+/// number of elements converted at once via float
+constexpr size_t s_floatBlockSize = 256;
+
+} // namespace
+
+// floatToHalf and halfToFloat are implemented by the simd kernels
+
+void
+GenH5::details::doubleToHalf(double const* src, uint16_t* dst,
+                             size_t n) noexcept
+{
+    float block[s_floatBlockSize];
+    for (size_t begin = 0; begin < n; begin += s_floatBlockSize)
+    {
+        size_t const count = std::min(s_floatBlockSize, n - begin);
+        for (size_t i = 0; i < count; ++i)
+        {
+            block[i] = toFloatRoundToOdd(src[begin + i]);
+        }
+        floatToHalf(block, dst + begin, count);
+    }
+}
+
+void
+GenH5::details::halfToDouble(uint16_t const* src, double* dst,
+                             size_t n) noexcept
+{
+    float block[s_floatBlockSize];
+    for (size_t begin = 0; begin < n; begin += s_floatBlockSize)
+    {
+        size_t const count = std::min(s_floatBlockSize, n - begin);
+        halfToFloat(src + begin, block, count);
+        floatToDouble(block, dst + begin, count);
+    }
+}
+
+void
+GenH5::details::floatToBFloat16(float const* src, uint16_t* dst,
+                                size_t n) noexcept
+{
+    for (size_t i = 0; i < n; ++i) dst[i] = floatToBFloat16Bits(src[i]);
+}
+
+void
+GenH5::details::doubleToBFloat16(double const* src, uint16_t* dst,
+                                 size_t n) noexcept
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        dst[i] = floatToBFloat16Bits(toFloatRoundToOdd(src[i]));
+    }
+}
+
+void
+GenH5::details::bFloat16ToFloat(uint16_t const* src, float* dst,
+                                size_t n) noexcept
+{
+    for (size_t i = 0; i < n; ++i) dst[i] = bFloat16BitsToFloat(src[i]);
+}
+
+void
+GenH5::details::bFloat16ToDouble(uint16_t const* src, double* dst,
+                                 size_t n) noexcept
+{
+    for (size_t i = 0; i < n; ++i) dst[i] = bFloat16BitsToFloat(src[i]);
+}
+
+namespace
+{
+
+/// number of elements converted at once
+constexpr size_t s_blockSize = 256;
+
+/**
+ * HDF5 conversion function using a bulk kernel. The conversion is done in
+ * place, thus elements are converted in blocks into a temporary buffer.
+ * Narrowing conversions start at the front, widening conversions at the
+ * back of the buffer, such that no unconverted elements are overwritten.
+ */
+template <typename Src, typename Dst,
+          void (*Kernel)(Src const*, Dst*, size_t) noexcept>
+herr_t
+convert(hid_t /*srcId*/, hid_t /*dstId*/, H5T_cdata_t* cdata,
+        size_t nelmts, size_t bufStride, size_t /*bkgStride*/,
+        void* buf, void* /*bkg*/, hid_t /*dxpl*/)
+{
+    switch (cdata->command)
+    {
+    case H5T_CONV_INIT:
+        cdata->need_bkg = H5T_BKG_NO;
+        return 0;
+    case H5T_CONV_FREE:
+        return 0;
+    case H5T_CONV_CONV:
+        break;
+    default:
+        return -1;
+    }
+
+    char* bytes = static_cast<char*>(buf);
+
+    // strided elements are converted one by one
+    if (bufStride != 0)
+    {
+        for (size_t i = 0; i < nelmts; ++i)
+        {
+            Src src;
+            Dst dst;
+            std::memcpy(&src, bytes + i * bufStride, sizeof(Src));
+            Kernel(&src, &dst, 1);
+            std::memcpy(bytes + i * bufStride, &dst, sizeof(Dst));
+        }
+        return 0;
+    }
+
+    Src srcBlock[s_blockSize];
+    Dst dstBlock[s_blockSize];
+
+    auto convertBlock = [&](size_t begin, size_t n){
+        std::memcpy(srcBlock, bytes + begin * sizeof(Src), n * sizeof(Src));
+        Kernel(srcBlock, dstBlock, n);
+        std::memcpy(bytes + begin * sizeof(Dst), dstBlock, n * sizeof(Dst));
+    };
+
+    if (sizeof(Dst) <= sizeof(Src))
+    {
+        for (size_t begin = 0; begin < nelmts; begin += s_blockSize)
+        {
+            convertBlock(begin, std::min(s_blockSize, nelmts - begin));
+        }
+    }
+    else
+    {
+        size_t end = nelmts;
+        while (end > 0)
+        {
+            size_t const n = std::min(s_blockSize, end);
+            end -= n;
+            convertBlock(end, n);
+        }
+    }
+
+    return 0;
+}
+
+template <typename Src, typename Dst,
+          void (*Kernel)(Src const*, Dst*, size_t) noexcept>
+bool
+registerConversion(char const* name, hid_t srcId, hid_t dstId)
+{
+    if (H5Tregister(H5T_PERS_HARD, name, srcId, dstId,
+                    convert<Src, Dst, Kernel>) < 0)
+    {
+        GenH5::log::ErrStream()
+                << GENH5_MAKE_EXECEPTION_STR()
+                   "Registering conversion failed: " << name;
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+bool
+GenH5::registerBuiltinConversions() noexcept
+{
+    static bool success = true;
+    static std::once_flag flag;
+
+    std::call_once(flag, [](){
+        using namespace details;
+
+        // the kernels operate on native floats and little endian half types
+        if (H5Tget_order(H5T_NATIVE_FLOAT) != H5T_ORDER_LE ||
+            H5Tget_order(H5T_NATIVE_DOUBLE) != H5T_ORDER_LE)
+        {
+            return;
+        }
+
+        hid_t const f32 = H5T_NATIVE_FLOAT;
+        hid_t const f64 = H5T_NATIVE_DOUBLE;
+        hid_t const f16 = DataType::Float16().id();
+        hid_t const bf16 = DataType::BFloat16().id();
+
+        success &=
+            registerConversion<float, uint16_t, floatToHalf>(
+                "genh5_f32_f16", f32, f16) &&
+            registerConversion<double, uint16_t, doubleToHalf>(
+                "genh5_f64_f16", f64, f16) &&
+            registerConversion<uint16_t, float, halfToFloat>(
+                "genh5_f16_f32", f16, f32) &&
+            registerConversion<uint16_t, double, halfToDouble>(
+                "genh5_f16_f64", f16, f64) &&
+            registerConversion<float, uint16_t, floatToBFloat16>(
+                "genh5_f32_bf16", f32, bf16) &&
+            registerConversion<double, uint16_t, doubleToBFloat16>(
+                "genh5_f64_bf16", f64, bf16) &&
+            registerConversion<uint16_t, float, bFloat16ToFloat>(
+                "genh5_bf16_f32", bf16, f32) &&
+            registerConversion<uint16_t, double, bFloat16ToDouble>(
+                "genh5_bf16_f64", bf16, f64);
+    });
+
+    return success;
+}
@@ -0,0 +1,218 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#ifndef GENH5_FLOAT16_H
+#define GENH5_FLOAT16_H
+
+#include "genh5_exports.h"
+
+#include <cmath>
+#include <cstring>
+#include <stdint.h>
+#include <stddef.h>
+#include <type_traits>
+
+namespace GenH5
+{
+
+namespace details
+{
+
+template <typename To, typename From>
+inline To
+bitCast(From const& value) noexcept
+{
+    static_assert(sizeof(To) == sizeof(From), "Sizes must match");
+    To to;
+    std::memcpy(&to, &value, sizeof(To));
+    return to;
+}
+
+/**
+ * Converts a float to IEEE 754 half precision (binary16), rounding to
+ * nearest even. Overflows become infinity. The implementation is
+ * branchless, such that loops over it can be vectorized.
+ */
+inline uint16_t
+floatToHalfBits(float value) noexcept
+{
+    uint32_t f = bitCast<uint32_t>(value);
+    uint32_t const sign = (f >> 16) & 0x8000u;
+    f &= 0x7fffffffu;
+
+    // normal: rebias exponent and round mantissa to nearest even
+    uint32_t const mantOdd = (f >> 13) & 1u;
+    uint32_t const normal = (f + 0xc8000fffu + mantOdd) >> 13;
+
+    // subnormal: let the FPU align and round the mantissa
+    uint32_t const denormMagic = 0x3f000000u;
+    uint32_t const subnormal =
+            bitCast<uint32_t>(bitCast<float>(f) +
+                              bitCast<float>(denormMagic)) - denormMagic;
+
+    // infinity and nan (quiet)
+    uint32_t const infNan = f > 0x7f800000u ? 0x7e00u : 0x7c00u;
+
+    uint32_t const h = f >= 0x47800000u ? infNan :
+                       f <  0x38800000u ? subnormal : normal;
+    return static_cast<uint16_t>(h | sign);
+}
+
+/// Converts IEEE 754 half precision to float (exact)
+inline float
+halfBitsToFloat(uint16_t bits) noexcept
+{
+    uint32_t const shiftedExp = 0x0f800000u;
+    uint32_t o = static_cast<uint32_t>(bits & 0x7fffu) << 13;
+    uint32_t const exp = o & shiftedExp;
+    o += 0x38000000u;
+
+    uint32_t const infNan = o + 0x38000000u;
+    uint32_t const subnormal =
+            bitCast<uint32_t>(bitCast<float>(o + 0x00800000u) -
+                              bitCast<float>(0x38800000u));
+
+    uint32_t const f = exp == shiftedExp ? infNan :
+                       exp == 0 ? subnormal : o;
+    return bitCast<float>(f | static_cast<uint32_t>(bits & 0x8000u) << 16);
+}
+
+/// Converts a float to bfloat16, rounding to nearest even
+inline uint16_t
+floatToBFloat16Bits(float value) noexcept
+{
+    uint32_t const f = bitCast<uint32_t>(value);
+    uint32_t const rounded = (f + 0x7fffu + ((f >> 16) & 1u)) >> 16;
+    // keep nan (quiet)
+    uint32_t const nan = (f >> 16) | 0x40u;
+    return static_cast<uint16_t>((f & 0x7fffffffu) > 0x7f800000u ? nan :
+                                                                   rounded);
+}
+
+/// Converts bfloat16 to float (exact)
+inline float
+bFloat16BitsToFloat(uint16_t bits) noexcept
+{
+    return bitCast<float>(static_cast<uint32_t>(bits) << 16);
+}
+
+/**
+ * Converts a double to float, rounding to odd (i.e. truncating and setting
+ * the last bit if the result is inexact). Rounding the result once more to
+ * a type with fewer mantissa bits yields the correctly rounded result,
+ * which converting via float using round to nearest does not.
+ */
+inline float
+toFloatRoundToOdd(double value) noexcept
+{
+    float const f = static_cast<float>(value);
+    double const back = f;
+    uint32_t u = bitCast<uint32_t>(f);
+    // rounded away from zero -> decrement magnitude
+    u -= std::fabs(back) > std::fabs(value) ? 1u : 0u;
+    u |= back != value ? 1u : 0u;
+    return bitCast<float>(u);
+}
+
+/** bulk conversions, used for converting datasets. Conversions between
+ *  float and half precision use the kernels of `simdLevel` (F16C or NEON),
+ *  the remaining conversions are scalar. **/
+GENH5_EXPORT void floatToHalf(float const* src, uint16_t* dst,
+                              size_t n) noexcept;
+GENH5_EXPORT void doubleToHalf(double const* src, uint16_t* dst,
+                               size_t n) noexcept;
+GENH5_EXPORT void halfToFloat(uint16_t const* src, float* dst,
+                              size_t n) noexcept;
+GENH5_EXPORT void halfToDouble(uint16_t const* src, double* dst,
+                               size_t n) noexcept;
+
+GENH5_EXPORT void floatToBFloat16(float const* src, uint16_t* dst,
+                                  size_t n) noexcept;
+GENH5_EXPORT void doubleToBFloat16(double const* src, uint16_t* dst,
+                                   size_t n) noexcept;
+GENH5_EXPORT void bFloat16ToFloat(uint16_t const* src, float* dst,
+                                  size_t n) noexcept;
+GENH5_EXPORT void bFloat16ToDouble(uint16_t const* src, double* dst,
+                                   size_t n) noexcept;
+
+/**
+ * Half precision type, stores the bits only. Arithmetic is done using float.
+ */
+template <uint16_t (*FromFloat)(float), float (*ToFloat)(uint16_t)>
+class HalfFloat
+{
+public:
+
+    constexpr HalfFloat() = default;
+
+    template <typename T,
+              std::enable_if_t<std::is_arithmetic<T>::value, bool> = true>
+    // cppcheck-suppress noExplicitConstructor
+    HalfFloat(T value) noexcept :
+        m_bits{FromFloat(toFloat(value))}
+    { }
+
+    /**
+     * @brief Instantiates the value using its bit representation
+     * @param bits Bits
+     * @return Value
+     */
+    static constexpr HalfFloat fromBits(uint16_t bits) noexcept
+    {
+        HalfFloat value;
+        value.m_bits = bits;
+        return value;
+    }
+
+    constexpr uint16_t bits() const noexcept { return m_bits; }
+
+    operator float() const noexcept { return ToFloat(m_bits); }
+
+private:
+
+    uint16_t m_bits{0};
+
+    static float toFloat(double value) noexcept
+    {
+        return toFloatRoundToOdd(value);
+    }
+    template <typename T>
+    static float toFloat(T value) noexcept
+    {
+        return static_cast<float>(value);
+    }
+};
+
+} // namespace details
+
+/// IEEE 754 half precision (binary16): 5 exponent and 10 mantissa bits
+using float16 = details::HalfFloat<details::floatToHalfBits,
+                                   details::halfBitsToFloat>;
+
+/// bfloat16: 8 exponent and 7 mantissa bits (same range as float)
+using bfloat16 = details::HalfFloat<details::floatToBFloat16Bits,
+                                    details::bFloat16BitsToFloat>;
+
+static_assert(sizeof(float16) == 2 && sizeof(bfloat16) == 2,
+              "Half precision types must have a size of two bytes");
+static_assert(std::is_trivially_copyable<float16>::value,
+              "Half precision types must be trivially copyable");
+
+/**
+ * @brief Registers conversion functions between float/double and the half
+ * precision datatypes with HDF5, which replace the generic (slow) soft
+ * conversion of HDF5. Results are rounded to nearest even. Is called
+ * automatically when opening a file.
+ * @return success
+ */
+GENH5_EXPORT bool registerBuiltinConversions() noexcept;
+
+} // namespace GenH5
+
+#endif // GENH5_FLOAT16_H
@@ -8,12 +8,16 @@
  */
 
 #include "genh5_group.h"
+#include "genh5_compressiontuner.h"
 #include "genh5_file.h"
+#include "genh5_fileindex.h"
 #include "genh5_private.h"
 
 #include "H5Gpublic.h"
 #include "H5Ppublic.h"
 
+#include <algorithm>
+
 GenH5::Group::Group() = default;
 
 GenH5::Group::Group(const File& file)
@@ -52,14 +56,19 @@ GenH5::Group::id() const noexcept
 void
 GenH5::Group::deleteLink() noexcept(false)
 {
+    auto f = file();
+    auto p = path();
+
     // returns error type
-    if (H5Ldelete(file().id(), path().constData(), H5P_DEFAULT) < 0)
+    if (H5Ldelete(f.id(), p.constData(), H5P_DEFAULT) < 0)
     {
         throw LocationException{
             GENH5_MAKE_EXECEPTION_STR() "Deleting group '" +
-            path().toStdString() + "' failed"
+            p.toStdString() + "' failed"
         };
     }
+    details::removeCachedHandles(f, p);
+    details::fileIndexRemove(f, std::move(p));
     close();
 }
 
@@ -123,7 +132,9 @@ GenH5::Group::createGroup(String const& name) const noexcept(false)
         auto cleanup = finally(H5Gclose, group);
         Q_UNUSED(cleanup)
 
-        return Group{group};
+        Group result{group};
+        details::fileIndexInsert(result);
+        return result;
     }
 
     // open existing group
@@ -141,13 +152,26 @@ GenH5::Group::openGroup(String const& name) const noexcept(false)
         };
     }
 
-    hid_t group = H5Gopen(m_id, name.constData(), H5P_DEFAULT);
+    // reuse cached group
+    hid_t group = details::findCachedHandle(m_id, name, IdType::Group);
+
     if (group < 0)
     {
-        throw GroupException{
-            GENH5_MAKE_EXECEPTION_STR() "Failed to open group '" +
-            name.toStdString() + '\''
-        };
+        // object may have been cached using a different location
+        auto key = details::handleCacheKey(m_id, name);
+        group = details::findCachedHandle(key, IdType::Group);
+        if (group < 0)
+        {
+            group = H5Gopen(m_id, name.constData(), H5P_DEFAULT);
+            if (group < 0)
+            {
+                throw GroupException{
+                    GENH5_MAKE_EXECEPTION_STR() "Failed to open group '" +
+                    name.toStdString() + '\''
+                };
+            }
+            details::cacheHandle(key, group);
+        }
     }
 
     auto cleanup = finally(H5Gclose, group);
@@ -170,17 +194,18 @@ GenH5::Group::createDataSet(String const& name,
         };
     }
 
-    // chunk dataset by default
-    if (properties.isDefault() && !dspace.isScalar() && dspace.size() > 0)
+    // choose layout by size by default
+    if (properties.isDefault())
     {
-        properties = DataSetCProperties::autoChunked(dspace);
+        properties = DataSetCProperties::defaultProperties(dspace, dtype);
     }
 
     // create new dataset
     if (!exists(name))
     {
-        hid_t dset = H5Dcreate(m_id, name.constData(), dtype.id(), dspace.id(),
-                               H5P_DEFAULT, properties->id(), H5P_DEFAULT);
+        hid_t dset = H5Dcreate(m_id, name.constData(), dtype.id(),
+                               dspace.id(), H5P_DEFAULT, properties->id(),
+                               H5P_DEFAULT);
         if (dset < 0)
         {
             throw DataSetException{
@@ -192,17 +217,22 @@ GenH5::Group::createDataSet(String const& name,
         auto cleanup = finally(H5Dclose, dset);
         Q_UNUSED(cleanup)
 
-        return DataSet{dset};
+        DataSet result{dset};
+        details::fileIndexInsert(result);
+        return result;
     }
 
     // open existing dataset
     auto dset = openDataSet(name);
 
-    // check if datatype is equal
-    if (dset.dataType() == dtype)
+    // check if datatype is equal, compound types may be stored packed
+    auto const type = dset.dataType();
+    if (type == dtype || type == dtype.packed())
     {
         // check if dataspace is equal or resizing succeded
-        if (dset.dataSpace() == dspace || dset.resize(dspace.dimensions()))
+        if (dset.dataSpace() == dspace ||
+            (dset.cProperties().isChunked() &&
+             dset.resize(dspace.dimensions())))
         {
             return dset;
         }
@@ -216,6 +246,41 @@ GenH5::Group::createDataSet(String const& name,
     return createDataSet(name, dtype, dspace, std::move(properties));
 }
 
+GenH5::Optional<GenH5::DataSetCProperties>
+GenH5::Group::tunedProperties(String const& name,
+                              void const* data,
+                              DataType const& dtype,
+                              DataSpace const& dspace,
+                              CompressionGoal goal) const noexcept(false)
+{
+    // existing datasets are reused by createDataSet if the datatype matches
+    // and the dataset can be resized
+    if (isValid() && exists(name))
+    {
+        auto dset = openDataSet(name);
+        auto const type = dset.dataType();
+        if (type == dtype || type == dtype.packed())
+        {
+            auto const current = dset.dataSpace();
+            if (current == dspace) return {};
+
+            auto const maxDims = current.maxDimensions();
+            auto const dims = dspace.dimensions();
+            if (dset.cProperties().isChunked() &&
+                maxDims.size() == dims.size() &&
+                std::equal(dims.begin(), dims.end(), maxDims.begin(),
+                           [](hsize_t dim, hsize_t max){
+                               return max == unlimited || dim <= max;
+                           }))
+            {
+                return {};
+            }
+        }
+    }
+
+    return tuneCompression(data, dtype, dspace, dspace, goal).properties;
+}
+
 GenH5::DataSet
 GenH5::Group::openDataSet(String const& name) const noexcept(false)
 {
@@ -227,13 +292,26 @@ GenH5::Group::openDataSet(String const& name) const noexcept(false)
         };
     }
 
-    hid_t dset = H5Dopen(m_id, name.constData(), H5P_DEFAULT);
+    // reuse cached dataset
+    hid_t dset = details::findCachedHandle(m_id, name, IdType::DataSet);
+
     if (dset < 0)
     {
-        throw DataSetException{
-            GENH5_MAKE_EXECEPTION_STR() "Failed to open dataset '" +
-            name.toStdString() + '\''
-        };
+        // object may have been cached using a different location
+        auto key = details::handleCacheKey(m_id, name);
+        dset = details::findCachedHandle(key, IdType::DataSet);
+        if (dset < 0)
+        {
+            dset = H5Dopen(m_id, name.constData(), H5P_DEFAULT);
+            if (dset < 0)
+            {
+                throw DataSetException{
+                    GENH5_MAKE_EXECEPTION_STR() "Failed to open dataset '" +
+                    name.toStdString() + '\''
+                };
+            }
+            details::cacheHandle(key, dset);
+        }
     }
 
     auto cleanup = finally(H5Dclose, dset);
@@ -267,6 +345,30 @@ GenH5::Group::findChildNodes(IterationType iterType,
     return nodes;
 }
 
+GenH5::Vector<GenH5::String>
+GenH5::Group::findChildNodeNames(IterationType iterType,
+                                 IterationIndex iterIndex,
+                                 IterationOrder iterOrder) const noexcept
+{
+    Vector<String> names;
+
+    auto h5index = static_cast<H5_index_t>(iterIndex);
+    auto h5order = static_cast<H5_iter_order_t>(iterOrder);
+
+    if (iterType == FindDirectOnly)
+    {
+        ::hsize_t idx = 0;
+        H5Literate(m_id, h5index, h5order, &idx,
+                   alg::accumulateNodeNames, &names);
+    }
+    else
+    {
+        H5Lvisit(m_id, h5index, h5order, alg::accumulateNodeNames, &names);
+    }
+
+    return names;
+}
+
 GenH5::herr_t
 GenH5::Group::iterateChildNodes(NodeIterationFunction iterFunction,
                                 IterationType iterType,
@@ -297,6 +399,15 @@ GenH5::Group::iterateChildNodes(NodeIterationFunction iterFunction,
     return error;
 }
 
+GenH5::ChildNodes
+GenH5::Group::children(IterationType iterType,
+                       IterationFilter iterFilter,
+                       IterationIndex iterIndex,
+                       IterationOrder iterOrder) const noexcept(false)
+{
+    return ChildNodes{*this, iterType, iterFilter, iterIndex, iterOrder};
+}
+
 GenH5::NodeInfo
 GenH5::Group::nodeInfo(String path) const noexcept(false)
 {
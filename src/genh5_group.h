@@ -11,6 +11,7 @@
 #define GENH5_GROUP_H
 
 #include "genh5_node.h"
+#include "genh5_childnodes.h"
 
 #include "genh5_datasetcproperties.h"
 #include "genh5_dataset.h"
@@ -19,6 +20,8 @@
 namespace GenH5
 {
 
+enum CompressionGoal : int;
+
 /// callback function type for iterating over nodes
 using NodeIterationFunction =
     std::function<herr_t(Group const&, NodeInfo const&)>;
@@ -88,8 +91,11 @@ public:
      * @param name Name of the dataset
      * @param dtype Datatype of the dataset
      * @param dspace Dataspace of the dataset
-     * @param cProps Optional Create properties. By default dataset will be
-     * chunked but not compressed.
+     * @param cProps Optional Create properties. By default small datasets
+     * will be compact and all other datasets chunked but not compressed (see
+     * `DataSetCProperties::defaultProperties`).
+     * @note To store compound types without padding pass `dtype.packed()`.
+     * An existing dataset storing the packed type is reused for `dtype`.
      * @return Dataset
      */
     DataSet createDataSet(String const& name,
@@ -132,6 +138,43 @@ public:
                          details::AbstractData<T> const& data
                          ) const noexcept(false);
 
+    /**
+     * @brief Overload. Compound types are stored using the layout specified
+     * (see `DataType::packed`). Reading and writing uses the memory layout.
+     * @param name Name of the dataset
+     * @param data Data to write
+     * @param layout Layout of compound types in the file
+     * @return Dataset
+     */
+    template <typename T>
+    DataSet writeDataSet(String const& name,
+                         details::AbstractData<T> const& data,
+                         CompoundLayout layout) const noexcept(false);
+
+    /**
+     * @brief Overload. The chunk dimensions and filters of the dataset are
+     * selected by trial-compressing the data (see `tuneCompression`). If the
+     * dataset exists and can be reused, the data is written without tuning.
+     * @param name Name of the dataset
+     * @param data Data to write
+     * @param goal Compression goal
+     * @return Dataset
+     */
+    template <typename T>
+    DataSet writeDataSet(String const& name,
+                         details::AbstractData<T> const& data,
+                         CompressionGoal goal) const noexcept(false);
+
+    /**
+     * @brief Overload for column data. Each column is written separately.
+     * @param name Name of the dataset
+     * @return data Data to write
+     * @return Dataset
+     */
+    template <typename... Ts>
+    DataSet writeDataSet(String const& name,
+                         ColumnData<Ts...> const& data) const noexcept(false);
+
     /**
      * @brief High level method for creating and writing to a dataset.
      * Cannot be used to write an object of type Data0D.
@@ -226,6 +269,20 @@ public:
                                     IterationOrder iterOrder = NativeOrder
                                     ) const noexcept;
 
+    /**
+     * @brief Returns the names (relative paths) of all child nodes. Neither
+     * the nodes nor their object headers are accessed, thus listing large
+     * groups is cheap. Use `findChildNodes` if the object type is required.
+     * @param iterType Iteration type (i.e. direct only or all recursive)
+     * @param indexType Indexing type
+     * @param indexOrder Order of the list
+     * @return Node names
+     */
+    Vector<String> findChildNodeNames(IterationType iterType = FindDirectOnly,
+                                      IterationIndex iterIndex = IndexName,
+                                      IterationOrder iterOrder = NativeOrder
+                                      ) const noexcept;
+
     /**
      * @brief Iterates over each child node and calls a function on it.
      * @param iterFunction Functon to invoke.
@@ -243,6 +300,25 @@ public:
                              IterationOrder iterOrder = NativeOrder
                              ) const noexcept;
 
+    /**
+     * @brief Lazy range over the child nodes. Nodes are retrieved one at a
+     * time while iterating, thus breaking out of the loop early is cheap.
+     * See `ChildNodes` for pruning subtrees and limiting the depth. The object
+     * type is only retrieved for filtered or recursive iterations (see
+     * `ChildNodes::setResolveTypes`). May throw.
+     * @param iterType Iteration type (i.e. direct only or all recursive)
+     * @param iterFilter Filter to use. If a filter is set, all info structs are
+     * guranteed to be of the type specified.
+     * @param indexType Indexing type
+     * @param indexOrder Order of the nodes within a group
+     * @return Child node range
+     */
+    ChildNodes children(IterationType iterType = FindDirectOnly,
+                        IterationFilter iterFilter = NoFilter,
+                        IterationIndex iterIndex = IndexName,
+                        IterationOrder iterOrder = NativeOrder
+                        ) const noexcept(false);
+
     /**
      * @brief Returns the info struct of the node specified. May throw.
      * @param name path to the node
@@ -258,20 +334,47 @@ private:
     /// group id
     IdComponent<IdType::Group> m_id;
 
+    /**
+     * @brief Selects the create properties for writing the data to the
+     * dataset specified by trial-compressing the data. Returns the default
+     * properties if the dataset exists and can be reused.
+     * @param name Name of the dataset
+     * @param data Pointer to the data
+     * @param dtype Datatype of the data
+     * @param dspace Dataspace of the data
+     * @param goal Compression goal
+     * @return create properties
+     */
+    Optional<DataSetCProperties> tunedProperties(String const& name,
+                                                 void const* data,
+                                                 DataType const& dtype,
+                                                 DataSpace const& dspace,
+                                                 CompressionGoal goal
+                                                 ) const noexcept(false);
+
     friend class Reference;
 };
 
+/// borrowed reference to a group
+using GroupRef = ObjectRef<Group>;
+
 
 namespace details
 {
 
-template <typename... Ts>
+template <typename Tdata>
 inline DataSet
 writeDataSetHelper(Group const& obj,
                    String const& name,
-                   details::AbstractData<Ts...> const& data) noexcept(false)
+                   Tdata const& data,
+                   Optional<DataSetCProperties> cProps = {},
+                   CompoundLayout layout = CompoundAligned) noexcept(false)
 {
-    auto dset = obj.createDataSet(name, data.dataType(), data.dataSpace());
+    auto dtype = data.dataType();
+    if (layout == CompoundPacked) dtype = dtype.packed();
+
+    auto dset = obj.createDataSet(name, dtype, data.dataSpace(),
+                                  std::move(cProps));
 
     if (!dset.write(data))
     {
@@ -324,6 +427,35 @@ Group::writeDataSet(String const& name,
     return details::writeDataSetHelper(*this, name, data);
 }
 
+template <typename T>
+inline DataSet
+Group::writeDataSet(String const& name,
+                    details::AbstractData<T> const& data,
+                    CompoundLayout layout) const noexcept(false)
+{
+    return details::writeDataSetHelper(*this, name, data, {}, layout);
+}
+
+template <typename T>
+inline DataSet
+Group::writeDataSet(String const& name,
+                    details::AbstractData<T> const& data,
+                    CompressionGoal goal) const noexcept(false)
+{
+    return details::writeDataSetHelper(
+                *this, name, data,
+                tunedProperties(name, data.dataWritePtr(), data.dataType(),
+                                data.dataSpace(), goal));
+}
+
+template <typename... Ts>
+inline DataSet
+Group::writeDataSet(String const& name,
+                    ColumnData<Ts...> const& data) const noexcept(false)
+{
+    return details::writeDataSetHelper(*this, name, data);
+}
+
 template <typename Container, traits::if_has_not_template_type<Container>>
 inline DataSet
 Group::writeDataSet0D(String const& name,
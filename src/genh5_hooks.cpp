@@ -9,6 +9,7 @@
 #include <genh5_file.h>
 #include <genh5_exception.h>
 
+#include <atomic>
 #include <unordered_map>
 #include <shared_mutex>
 
@@ -33,6 +34,13 @@ static std::shared_mutex& mutex()
     return mutex;
 }
 
+/// number of files with hooks, avoids locking if no hooks are registered
+static std::atomic<size_t>& count()
+{
+    static std::atomic<size_t> count{0};
+    return count;
+}
+
 } // namespace
 
 GenH5::Hook
@@ -88,7 +96,11 @@ bool clearHook(hid_t fileId, HookType type)
     if (iter == dataBase.end()) return false;
 
     // remove all hooks
-    if (type == UnknownHook) dataBase.erase(iter);
+    if (type == UnknownHook)
+    {
+        dataBase.erase(iter);
+        HookDataBase::count() = dataBase.size();
+    }
     // remove only the selected hook
     else iter->second[type - 1] = {};
 
@@ -142,7 +154,25 @@ GenH5::registerHook(File const& file, HookType type, Hook hook) noexcept(false)
     if (iter == dataBase.end())
     {
         iter = dataBase.insert({ fileId, HookDataBase::Entry{} }).first;
+        HookDataBase::count() = dataBase.size();
     }
 
     (iter->second)[type - 1] = std::move(hook);
 }
+
+bool
+GenH5::details::hasHooks() noexcept
+{
+    return HookDataBase::count() > 0;
+}
+
+GenH5::Hook
+GenH5::details::findObjectHook(hid_t id, HookType type) noexcept(false)
+{
+    if (!hasHooks()) return {};
+
+    File file = File::fromId(H5Iget_file_id(id));
+    if (!file.isValid()) return {};
+
+    return findHook(file, type);
+}
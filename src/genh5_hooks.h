@@ -154,6 +154,18 @@ bool clearHook(File const& file, HookType type);
 GENH5_EXPORT
 void registerHook(File const& file, HookType type, Hook hook) noexcept(false);
 
+namespace details
+{
+
+/// whether any hooks are registered at all
+GENH5_EXPORT bool hasHooks() noexcept;
+
+/// finds the hook for the file of the object `id`. The file is only retrieved
+/// if any hooks are registered.
+GENH5_EXPORT Hook findObjectHook(hid_t id, HookType type) noexcept(false);
+
+} // namespace details
+
 /**
  * @brief Converts `hook` into a compatible functor. Useful if `hook` does not
  * return `HookReturnValue`. Defaults to `HookContinue`.
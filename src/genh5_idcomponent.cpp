@@ -9,6 +9,7 @@
 
 #include "genh5_idcomponent.h"
 #include "genh5_hooks.h"
+#include "genh5_fileindex.h"
 
 #include "H5Ipublic.h"
 
@@ -22,11 +23,19 @@ int
 GenH5::decId(hid_t id)
 {
     // remove all file-sepcific hooks if file handle is closed
-    if (classType(id) == IdType::File && refCount(id) == 1)
+    if (details::hasHooks() &&
+        classType(id) == IdType::File && refCount(id) == 1)
     {
         clearHooks(id);
     }
 
+    // same for the file index
+    if (details::hasFileIndices() &&
+        classType(id) == IdType::File && refCount(id) == 1)
+    {
+        details::clearFileIndex(id);
+    }
+
     return H5Idec_ref(id);
 }
 
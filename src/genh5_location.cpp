@@ -103,8 +103,8 @@ GenH5::Location::path() const noexcept
 GenH5::File
 GenH5::Location::file() const noexcept
 {
-    auto f = fileId();
-    return File{f.get()};
+    // takes ownership of the id returned
+    return File::fromId(H5Iget_file_id(this->id()));
 }
 
 GenH5::IdComponent<GenH5::IdType::File>
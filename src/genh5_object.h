@@ -59,6 +59,51 @@ protected:
     Object() = default;
 };
 
+/**
+ * @brief The ObjectRef class. Borrowed, non-owning reference to an object.
+ * Copying, passing or destroying the reference does not alter the reference
+ * count of the id. Intended for hot paths (e.g. as function parameters),
+ * the referenced object must outlive the reference.
+ */
+template <typename T>
+class ObjectRef
+{
+public:
+
+    ObjectRef() = default;
+
+    /**
+     * @brief Borrows the id of the object
+     * @param object Object to reference
+     */
+    ObjectRef(T const& object) noexcept : m_id{object.id()} { }
+    // temporaries would be destroyed before the reference is used
+    ObjectRef(T&& object) = delete;
+
+    /**
+     * @brief id of the referenced object
+     * @return id
+     */
+    hid_t id() const noexcept { return m_id; }
+
+    /**
+     * @brief returns whether the referenced id is valid
+     * @return is valid
+     */
+    bool isValid() const noexcept { return Object::isValid(m_id); }
+
+    /**
+     * @brief Creates an owning object. Increments the reference count.
+     * @return Object
+     */
+    T toObject() const noexcept(false) { return T{m_id}; }
+
+private:
+
+    /// borrowed id
+    hid_t m_id{-1};
+};
+
 } // namespace GenH5
 
 #endif // GENH5_OBJECT_H
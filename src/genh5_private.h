@@ -14,6 +14,7 @@
 
 #include <H5Ipublic.h>
 #include <H5Lpublic.h>
+#include <H5Opublic.h>
 #include <H5Apublic.h>
 
 #include <algorithm>
@@ -145,29 +146,67 @@ getName(hid_t id, Functor const& getNameFunctor)
     return buffer.trimmed().chopped(1);
 }
 
+/// path relative to the root group without leading and trailing '/'
+inline String
+normalizedPath(String path)
+{
+    while (path.startsWith('/')) path.remove(0, 1);
+    while (path.endsWith('/')) path.chop(1);
+    return path;
+}
+
 } // namespace details
 
 namespace alg
 {
 
+/// maps the HDF5 object type onto the corresponding id type
+inline IdType toIdType(H5O_type_t type)
+{
+    switch (type)
+    {
+    case H5O_TYPE_GROUP:
+        return IdType::Group;
+    case H5O_TYPE_DATASET:
+        return IdType::DataSet;
+    case H5O_TYPE_NAMED_DATATYPE:
+        return IdType::DataType;
+    default:
+        return IdType::BadId;
+    }
+}
+
 inline NodeInfo getNodeInfo(hid_t groupId, char const* nodeName,
                             H5L_info_t const* nodeInfo)
 {
     assert(nodeName);
     assert(nodeInfo);
-    // open object to retrieve object type
-    auto id = H5Oopen_by_token(groupId, nodeInfo->u.token);
-    auto type = H5Iget_type(id);
-    H5Oclose(id);
+    // retrieve object type from the object header instead of opening the
+    // object, only the basic fields are queried
+    H5O_info2_t objInfo{};
+    herr_t err = H5Oget_info_by_name3(groupId, nodeName, &objInfo,
+                                      H5O_INFO_BASIC, H5P_DEFAULT);
 
     NodeInfo info;
     info.path = QByteArray{nodeName};
-    info.type = static_cast<IdType>(type);
+    info.type = err < 0 ? IdType::BadId : toIdType(objInfo.type);
     info.corder = nodeInfo->corder_valid ? nodeInfo->corder : -1;
     memcpy(info.token.__data, nodeInfo->u.token.__data, sizeof(nodeInfo->u.token.__data));
     return info;
 }
 
+inline herr_t
+accumulateNodeNames(hid_t /*groupId*/, char const* nodeName,
+                    H5L_info_t const* /*nodeInfo*/, void* dataPtr)
+{
+    assert(dataPtr);
+    assert(nodeName);
+
+    auto* names = static_cast<Vector<String>*>(dataPtr);
+    *names << QByteArray{nodeName};
+    return 0;
+}
+
 struct IterAccumulateData
 {
     Vector<NodeInfo>* nodes{};
@@ -0,0 +1,111 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#include "genh5_readcontext.h"
+#include "genh5_private.h"
+
+#include "H5Spublic.h"
+
+namespace
+{
+
+inline GenH5::herr_t
+selectHyperslab(GenH5::hid_t space,
+                GenH5::Dimensions const& offset,
+                GenH5::Dimensions const& count)
+{
+    // HDF5 dimensions may differ from GenH5 dimensions. Convert them using
+    // stack memory to avoid allocating
+    ::hsize_t h5Offset[H5S_MAX_RANK];
+    ::hsize_t h5Count[H5S_MAX_RANK];
+
+    auto const rank = std::min(static_cast<int>(H5S_MAX_RANK),
+                               static_cast<int>(offset.size()));
+    std::copy_n(offset.cbegin(), rank, h5Offset);
+    std::copy_n(count.cbegin(), rank, h5Count);
+
+    return H5Sselect_hyperslab(space, H5S_SELECT_SET,
+                               h5Offset, nullptr, h5Count, nullptr);
+}
+
+} // namespace
+
+GenH5::details::ReadContextBase::ReadContextBase() = default;
+
+GenH5::details::ReadContextBase::ReadContextBase(DataSet dset,
+                                                 DataType memType,
+                                                 Dimensions count,
+                                                 Dimensions offset
+                                                 ) noexcept(false) :
+    m_dset{std::move(dset)},
+    m_memType{std::move(memType)}
+{
+    if (!m_dset.isValid())
+    {
+        throw DataSetException{
+            GENH5_MAKE_EXECEPTION_STR()
+            "Creating read context failed (invalid dataset)"
+        };
+    }
+
+    // selects the hyperslab and fills missing dimensions
+    DataSpaceSelection selection{m_dset.dataSpace(), std::move(count),
+                                 std::move(offset)};
+    m_fileSpace = selection.space();
+    m_count = selection.count();
+
+    m_selectionSize = static_cast<hsize_t>(m_fileSpace.selectionSize());
+    m_memSpace = DataSpace::linear(m_selectionSize);
+}
+
+bool
+GenH5::details::ReadContextBase::isValid() const noexcept
+{
+    return m_dset.isValid() && m_fileSpace.isValid() &&
+           m_memSpace.isValid() && m_memType.isValid();
+}
+
+bool
+GenH5::details::ReadContextBase::setOffset(Dimensions const& offset
+                                           ) noexcept(false)
+{
+    if (offset.size() != m_count.size())
+    {
+        log::ErrStream()
+                << GENH5_MAKE_EXECEPTION_STR() "Setting offset failed "
+                   "(dimensions out of range: " << offset.size() << " vs. "
+                << m_count.size() << ')';
+        return false;
+    }
+
+    herr_t err = selectHyperslab(m_fileSpace.id(), offset, m_count);
+    if (err < 0 || H5Sselect_valid(m_fileSpace.id()) <= 0)
+    {
+        log::ErrStream()
+                << GENH5_MAKE_EXECEPTION_STR() "Setting offset failed "
+                   "(invalid selection)";
+        return false;
+    }
+
+    return true;
+}
+
+bool
+GenH5::details::ReadContextBase::readInto(void* data) const noexcept(false)
+{
+    if (!isValid())
+    {
+        log::ErrStream()
+                << GENH5_MAKE_EXECEPTION_STR() "Reading data failed "
+                   "(invalid read context)";
+        return false;
+    }
+
+    return m_dset.readDirect(data, m_fileSpace, m_memSpace, m_memType);
+}
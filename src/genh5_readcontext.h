@@ -0,0 +1,192 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#ifndef GENH5_READCONTEXT_H
+#define GENH5_READCONTEXT_H
+
+#include "genh5_dataset.h"
+#include "genh5_data/view.h"
+
+namespace GenH5
+{
+
+namespace details
+{
+
+/**
+ * @brief The ReadContextBase class. Holds the dataset, the file selection, the
+ * memory dataspace and the memory datatype of a read context.
+ */
+class GENH5_EXPORT ReadContextBase
+{
+public:
+
+    /**
+     * @brief Whether the context is bound to a valid dataset.
+     * @return is valid
+     */
+    bool isValid() const noexcept;
+
+    /**
+     * @brief Dataset the context is bound to.
+     * @return dataset
+     */
+    DataSet const& dataSet() const noexcept { return m_dset; }
+
+    /**
+     * @brief File dataspace containing the current selection
+     * @return file dataspace
+     */
+    DataSpace const& fileSpace() const noexcept { return m_fileSpace; }
+
+    /**
+     * @brief Memory dataspace
+     * @return memory dataspace
+     */
+    DataSpace const& memSpace() const noexcept { return m_memSpace; }
+
+    /**
+     * @brief Memory datatype
+     * @return memory datatype
+     */
+    DataType const& dataType() const noexcept { return m_memType; }
+
+    /**
+     * @brief Number of elements read each time.
+     * @return selection size
+     */
+    hsize_t selectionSize() const noexcept { return m_selectionSize; }
+
+    /**
+     * @brief Dimensions of the selection (i.e. the block read each time).
+     * @return dimensions
+     */
+    Dimensions const& dimensions() const noexcept { return m_count; }
+
+    /**
+     * @brief Moves the selection to the offset specified. The number of
+     * elements selected is kept, thus no reallocation is necessary.
+     * @param offset Offset in each dimension. Must match the number of
+     * dimensions of the dataset.
+     * @return success
+     */
+    bool setOffset(Dimensions const& offset) noexcept(false);
+
+protected:
+
+    ReadContextBase();
+    ReadContextBase(DataSet dset,
+                    DataType memType,
+                    Dimensions count,
+                    Dimensions offset) noexcept(false);
+
+    /// reads the current selection into data
+    bool readInto(void* data) const noexcept(false);
+
+private:
+
+    /// dataset
+    DataSet m_dset{};
+    /// file dataspace holding the selection
+    DataSpace m_fileSpace{};
+    /// memory dataspace
+    DataSpace m_memSpace{};
+    /// memory datatype
+    DataType m_memType{};
+    /// number of elements selected in each dimension
+    Dimensions m_count{};
+    /// total number of elements selected
+    hsize_t m_selectionSize{};
+};
+
+} // namespace details
+
+/**
+ * @brief The ReadContext class. Reusable context for reading the same
+ * selection of a dataset repeatedly (e.g. one time step after another). The
+ * buffer, the memory dataspace, the memory datatype and the file selection are
+ * created once, thus reading does not allocate memory or create any HDF5
+ * objects, apart from what H5Dread does internally.
+ * The selection can be moved using `setOffset`. Requires a type that is not
+ * converted.
+ */
+template<typename T>
+class ReadContext : public details::ReadContextBase
+{
+    static_assert(std::is_same<conversion_t<T>, T>::value &&
+                  std::is_trivially_copyable<T>::value,
+                  "Read contexts require a trivially copyable type that is "
+                  "not converted!");
+
+public:
+
+    using value_type     = T;
+    using container_type = Vector<T>;
+    using size_type      = typename container_type::size_type;
+
+    ReadContext() = default;
+
+    /**
+     * @brief Binds the context to the dataset.
+     * @param dset Dataset to read from
+     * @param count Number of elements to read in each dimension. Defaults to
+     * the entire dataset or 1 for each missing dimension.
+     * @param offset Initial offset in each dimension. Defaults to 0.
+     */
+    explicit ReadContext(DataSet dset,
+                         Dimensions count = {},
+                         Dimensions offset = {}) noexcept(false) :
+        ReadContextBase(std::move(dset), GenH5::dataType<T>(),
+                        std::move(count), std::move(offset))
+    {
+        m_data.resize(static_cast<size_type>(selectionSize()));
+    }
+
+    /**
+     * @brief Reads the current selection into the buffer of the context.
+     * @return success
+     */
+    bool read() noexcept(false)
+    {
+        return readInto(m_data.data());
+    }
+
+    /**
+     * @brief Overload. Moves the selection to offset before reading.
+     * @param offset Offset in each dimension
+     * @return success
+     */
+    bool read(Dimensions const& offset) noexcept(false)
+    {
+        return setOffset(offset) && read();
+    }
+
+    /** data **/
+    // buffer holding the data read last
+    container_type const& data() const { return m_data; }
+
+    // non-owning view of the data read last
+    DataView<T> view() const
+    {
+        return DataView<T>{m_data.constData(), dimensions()};
+    }
+
+    T const& operator[](size_type i) const { return m_data[i]; }
+
+    size_type size() const { return m_data.size(); }
+
+private:
+
+    /// buffer for reading
+    container_type m_data{};
+};
+
+} // namespace GenH5
+
+#endif // GENH5_READCONTEXT_H
@@ -0,0 +1,1096 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#include "genh5_simd.h"
+#include "genh5_datatype.h"
+#include "genh5_exception.h"
+#include "genh5_float16.h"
+
+#include <H5Tpublic.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64) || \
+    defined(__i386__) || defined(_M_IX86)
+#define GENH5_SIMD_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define GENH5_TARGET(X)
+#else
+#include <cpuid.h>
+#define GENH5_TARGET(X) __attribute__((target(X)))
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define GENH5_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+namespace
+{
+
+/** scalar kernels, also used for the remaining elements **/
+
+template <typename Src, typename Dst>
+inline void
+convertScalar(Src const* src, Dst* dst, size_t n) noexcept
+{
+    for (size_t i = 0; i < n; ++i) dst[i] = static_cast<Dst>(src[i]);
+}
+
+/// narrows integers, values out of range are clamped
+template <typename Src, typename Dst>
+inline void
+saturateScalar(Src const* src, Dst* dst, size_t n) noexcept
+{
+    constexpr Src lowest = static_cast<Src>(std::numeric_limits<Dst>::lowest());
+    constexpr Src max = static_cast<Src>(std::numeric_limits<Dst>::max());
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        dst[i] = static_cast<Dst>(std::min(std::max(src[i], lowest), max));
+    }
+}
+
+template <typename T>
+inline void
+byteSwapScalar(void* data, size_t n) noexcept
+{
+    unsigned char* bytes = static_cast<unsigned char*>(data);
+    for (size_t i = 0; i < n; ++i)
+    {
+        std::reverse(bytes + i * sizeof(T), bytes + (i + 1) * sizeof(T));
+    }
+}
+
+/// number of bytes required to store `n` bits
+constexpr size_t
+byteCount(size_t n) noexcept
+{
+    return (n + 7) / 8;
+}
+
+static_assert(sizeof(bool) == 1, "Booleans must have a size of one byte");
+
+void
+packBitsScalar(bool const* src, uint8_t* dst, size_t n) noexcept
+{
+    std::memset(dst, 0, byteCount(n));
+    for (size_t i = 0; i < n; ++i)
+    {
+        dst[i / 8] = static_cast<uint8_t>(dst[i / 8] | (src[i] << (i % 8)));
+    }
+}
+
+void
+unpackBitsScalar(uint8_t const* src, bool* dst, size_t n) noexcept
+{
+    for (size_t i = 0; i < n; ++i) dst[i] = (src[i / 8] >> (i % 8)) & 1;
+}
+
+void
+floatToHalfScalar(float const* src, uint16_t* dst, size_t n) noexcept
+{
+    using GenH5::details::floatToHalfBits;
+    for (size_t i = 0; i < n; ++i) dst[i] = floatToHalfBits(src[i]);
+}
+
+void
+halfToFloatScalar(uint16_t const* src, float* dst, size_t n) noexcept
+{
+    using GenH5::details::halfBitsToFloat;
+    for (size_t i = 0; i < n; ++i) dst[i] = halfBitsToFloat(src[i]);
+}
+
+/// kernels of one instruction set
+struct Kernels
+{
+    void (*doubleToFloat)(double const*, float*, size_t);
+    void (*floatToDouble)(float const*, double*, size_t);
+    void (*int64ToInt32)(int64_t const*, int32_t*, size_t);
+    void (*int32ToInt64)(int32_t const*, int64_t*, size_t);
+    void (*uint64ToUint32)(uint64_t const*, uint32_t*, size_t);
+    void (*uint32ToUint64)(uint32_t const*, uint64_t*, size_t);
+    void (*byteSwap16)(void*, size_t);
+    void (*byteSwap32)(void*, size_t);
+    void (*byteSwap64)(void*, size_t);
+    void (*packBits)(bool const*, uint8_t*, size_t);
+    void (*unpackBits)(uint8_t const*, bool*, size_t);
+    void (*floatToHalf)(float const*, uint16_t*, size_t);
+    void (*halfToFloat)(uint16_t const*, float*, size_t);
+};
+
+constexpr Kernels s_scalarKernels{
+    convertScalar<double, float>,
+    convertScalar<float, double>,
+    saturateScalar<int64_t, int32_t>,
+    convertScalar<int32_t, int64_t>,
+    saturateScalar<uint64_t, uint32_t>,
+    convertScalar<uint32_t, uint64_t>,
+    byteSwapScalar<uint16_t>,
+    byteSwapScalar<uint32_t>,
+    byteSwapScalar<uint64_t>,
+    packBitsScalar,
+    unpackBitsScalar,
+    floatToHalfScalar,
+    halfToFloatScalar
+};
+
+#ifdef GENH5_SIMD_X86
+
+/** SSE2 kernels **/
+
+GENH5_TARGET("sse2") void
+sse2DoubleToFloat(double const* src, float* dst, size_t n)
+{
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+    {
+        __m128 f = _mm_cvtpd_ps(_mm_loadu_pd(src + i));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i),
+                         _mm_castps_si128(f));
+    }
+    convertScalar(src + i, dst + i, n - i);
+}
+
+GENH5_TARGET("sse2") void
+sse2FloatToDouble(float const* src, double* dst, size_t n)
+{
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128 f = _mm_loadu_ps(src + i);
+        _mm_storeu_pd(dst + i, _mm_cvtps_pd(f));
+        _mm_storeu_pd(dst + i + 2, _mm_cvtps_pd(_mm_movehl_ps(f, f)));
+    }
+    convertScalar(src + i, dst + i, n - i);
+}
+
+/// widens 32 bit integers, `Signed` selects sign or zero extension
+template <bool Signed>
+GENH5_TARGET("sse2") void
+sse2Widen32(void const* src, void* dst, size_t n)
+{
+    auto const* s = static_cast<__m128i const*>(src);
+    auto* d = static_cast<__m128i*>(dst);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4, ++s, d += 2)
+    {
+        __m128i v = _mm_loadu_si128(s);
+        __m128i ext = Signed ? _mm_srai_epi32(v, 31) : _mm_setzero_si128();
+        _mm_storeu_si128(d, _mm_unpacklo_epi32(v, ext));
+        _mm_storeu_si128(d + 1, _mm_unpackhi_epi32(v, ext));
+    }
+
+    if (Signed)
+    {
+        convertScalar(static_cast<int32_t const*>(src) + i,
+                      static_cast<int64_t*>(dst) + i, n - i);
+    }
+    else
+    {
+        convertScalar(static_cast<uint32_t const*>(src) + i,
+                      static_cast<uint64_t*>(dst) + i, n - i);
+    }
+}
+
+void
+sse2Int32ToInt64(int32_t const* src, int64_t* dst, size_t n)
+{
+    sse2Widen32<true>(src, dst, n);
+}
+
+void
+sse2Uint32ToUint64(uint32_t const* src, uint64_t* dst, size_t n)
+{
+    sse2Widen32<false>(src, dst, n);
+}
+
+GENH5_TARGET("sse2") inline __m128i
+sse2Swap16(__m128i v)
+{
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+GENH5_TARGET("sse2") void
+sse2ByteSwap16(void* data, size_t n)
+{
+    auto* d = static_cast<__m128i*>(data);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8, ++d)
+    {
+        _mm_storeu_si128(d, sse2Swap16(_mm_loadu_si128(d)));
+    }
+    byteSwapScalar<uint16_t>(static_cast<uint16_t*>(data) + i, n - i);
+}
+
+GENH5_TARGET("sse2") void
+sse2ByteSwap32(void* data, size_t n)
+{
+    auto* d = static_cast<__m128i*>(data);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4, ++d)
+    {
+        // swap bytes, then the 16 bit words of each element
+        __m128i v = sse2Swap16(_mm_loadu_si128(d));
+        v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+        v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+        _mm_storeu_si128(d, v);
+    }
+    byteSwapScalar<uint32_t>(static_cast<uint32_t*>(data) + i, n - i);
+}
+
+GENH5_TARGET("sse2") void
+sse2ByteSwap64(void* data, size_t n)
+{
+    auto* d = static_cast<__m128i*>(data);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2, ++d)
+    {
+        // swap bytes, then reverse the 16 bit words of each element
+        __m128i v = sse2Swap16(_mm_loadu_si128(d));
+        v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+        v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+        _mm_storeu_si128(d, v);
+    }
+    byteSwapScalar<uint64_t>(static_cast<uint64_t*>(data) + i, n - i);
+}
+
+GENH5_TARGET("sse2") void
+sse2PackBits(bool const* src, uint8_t* dst, size_t n)
+{
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i));
+        // the sign bit of each byte is gathered in order
+        auto bits = static_cast<uint16_t>(
+                    _mm_movemask_epi8(_mm_cmpgt_epi8(v, _mm_setzero_si128())));
+        std::memcpy(dst + i / 8, &bits, sizeof(bits));
+    }
+    packBitsScalar(src + i, dst + i / 8, n - i);
+}
+
+GENH5_TARGET("sse2") void
+sse2UnpackBits(uint8_t const* src, bool* dst, size_t n)
+{
+    __m128i const weights = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                                          1, 2, 4, 8, 16, 32, 64, -128);
+    __m128i const one = _mm_set1_epi8(1);
+
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        uint16_t bits;
+        std::memcpy(&bits, src + i / 8, sizeof(bits));
+        // broadcast the first byte to the lower half, the second to the
+        // upper half
+        __m128i v = _mm_cvtsi32_si128(bits);
+        v = _mm_unpacklo_epi8(v, v);
+        v = _mm_unpacklo_epi16(v, v);
+        v = _mm_unpacklo_epi32(v, v);
+        v = _mm_cmpeq_epi8(_mm_and_si128(v, weights), weights);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                         _mm_and_si128(v, one));
+    }
+    unpackBitsScalar(src + i / 8, dst + i, n - i);
+}
+
+constexpr Kernels s_sse2Kernels{
+    sse2DoubleToFloat,
+    sse2FloatToDouble,
+    // SSE2 lacks 64 bit comparisons
+    saturateScalar<int64_t, int32_t>,
+    sse2Int32ToInt64,
+    saturateScalar<uint64_t, uint32_t>,
+    sse2Uint32ToUint64,
+    sse2ByteSwap16,
+    sse2ByteSwap32,
+    sse2ByteSwap64,
+    sse2PackBits,
+    sse2UnpackBits,
+    // half conversions require F16C
+    floatToHalfScalar,
+    halfToFloatScalar
+};
+
+/** AVX2 kernels **/
+
+GENH5_TARGET("avx2") void
+avx2DoubleToFloat(double const* src, float* dst, size_t n)
+{
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        _mm_storeu_ps(dst + i, _mm256_cvtpd_ps(_mm256_loadu_pd(src + i)));
+    }
+    convertScalar(src + i, dst + i, n - i);
+}
+
+GENH5_TARGET("avx2") void
+avx2FloatToDouble(float const* src, double* dst, size_t n)
+{
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        _mm256_storeu_pd(dst + i, _mm256_cvtps_pd(_mm_loadu_ps(src + i)));
+    }
+    convertScalar(src + i, dst + i, n - i);
+}
+
+/// stores the lower 32 bits of each 64 bit integer
+GENH5_TARGET("avx2") inline void
+avx2StoreLow32(void* dst, __m256i v)
+{
+    __m256i const idx = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    _mm_storeu_si128(static_cast<__m128i*>(dst),
+                     _mm256_castsi256_si128(
+                         _mm256_permutevar8x32_epi32(v, idx)));
+}
+
+GENH5_TARGET("avx2") void
+avx2Int64ToInt32(int64_t const* src, int32_t* dst, size_t n)
+{
+    __m256i const lowest =
+            _mm256_set1_epi64x(std::numeric_limits<int32_t>::lowest());
+    __m256i const max =
+            _mm256_set1_epi64x(std::numeric_limits<int32_t>::max());
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256i v = _mm256_loadu_si256(
+                    reinterpret_cast<__m256i const*>(src + i));
+        v = _mm256_blendv_epi8(v, max, _mm256_cmpgt_epi64(v, max));
+        v = _mm256_blendv_epi8(v, lowest, _mm256_cmpgt_epi64(lowest, v));
+        avx2StoreLow32(dst + i, v);
+    }
+    saturateScalar(src + i, dst + i, n - i);
+}
+
+GENH5_TARGET("avx2") void
+avx2Uint64ToUint32(uint64_t const* src, uint32_t* dst, size_t n)
+{
+    // compare unsigned integers by flipping the sign bit
+    __m256i const bias =
+            _mm256_set1_epi64x(std::numeric_limits<int64_t>::lowest());
+    __m256i const max =
+            _mm256_set1_epi64x(std::numeric_limits<uint32_t>::max());
+    __m256i const biasedMax = _mm256_xor_si256(max, bias);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256i v = _mm256_loadu_si256(
+                    reinterpret_cast<__m256i const*>(src + i));
+        __m256i overflow =
+                _mm256_cmpgt_epi64(_mm256_xor_si256(v, bias), biasedMax);
+        avx2StoreLow32(dst + i, _mm256_blendv_epi8(v, max, overflow));
+    }
+    saturateScalar(src + i, dst + i, n - i);
+}
+
+GENH5_TARGET("avx2") void
+avx2Int32ToInt64(int32_t const* src, int64_t* dst, size_t n)
+{
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                            _mm256_cvtepi32_epi64(v));
+    }
+    convertScalar(src + i, dst + i, n - i);
+}
+
+GENH5_TARGET("avx2") void
+avx2Uint32ToUint64(uint32_t const* src, uint64_t* dst, size_t n)
+{
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                            _mm256_cvtepu32_epi64(v));
+    }
+    convertScalar(src + i, dst + i, n - i);
+}
+
+/// reverses the bytes of each element using a byte shuffle
+template <typename T>
+GENH5_TARGET("avx2") void
+avx2ByteSwap(void* data, size_t n)
+{
+    constexpr size_t size = sizeof(T);
+    constexpr size_t perVector = 32 / size;
+
+    // the shuffle operates on 128 bit lanes
+    alignas(32) int8_t mask[32];
+    for (size_t i = 0; i < 32; ++i)
+    {
+        size_t const j = i % 16;
+        mask[i] = static_cast<int8_t>(j - j % size + size - 1 - j % size);
+    }
+    __m256i const shuffle =
+            _mm256_load_si256(reinterpret_cast<__m256i const*>(mask));
+
+    auto* d = static_cast<__m256i*>(data);
+    size_t i = 0;
+    for (; i + perVector <= n; i += perVector, ++d)
+    {
+        _mm256_storeu_si256(d, _mm256_shuffle_epi8(_mm256_loadu_si256(d),
+                                                   shuffle));
+    }
+    byteSwapScalar<T>(static_cast<T*>(data) + i, n - i);
+}
+
+GENH5_TARGET("avx2") void
+avx2PackBits(bool const* src, uint8_t* dst, size_t n)
+{
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        __m256i v = _mm256_loadu_si256(
+                    reinterpret_cast<__m256i const*>(src + i));
+        auto bits = static_cast<uint32_t>(_mm256_movemask_epi8(
+                    _mm256_cmpgt_epi8(v, _mm256_setzero_si256())));
+        std::memcpy(dst + i / 8, &bits, sizeof(bits));
+    }
+    packBitsScalar(src + i, dst + i / 8, n - i);
+}
+
+GENH5_TARGET("avx2") void
+avx2UnpackBits(uint8_t const* src, bool* dst, size_t n)
+{
+    // byte k of the result holds source byte k / 8 (the shuffle operates on
+    // 128 bit lanes, each lane holds all four source bytes)
+    __m256i const shuffle = _mm256_setr_epi8(
+                0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+                2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+    __m256i const weights = _mm256_set1_epi64x(
+                static_cast<int64_t>(0x8040201008040201ull));
+    __m256i const one = _mm256_set1_epi8(1);
+
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        int32_t bits;
+        std::memcpy(&bits, src + i / 8, sizeof(bits));
+        __m256i v = _mm256_shuffle_epi8(_mm256_set1_epi32(bits), shuffle);
+        v = _mm256_cmpeq_epi8(_mm256_and_si256(v, weights), weights);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                            _mm256_and_si256(v, one));
+    }
+    unpackBitsScalar(src + i / 8, dst + i, n - i);
+}
+
+/** F16C kernels, available on all CPUs supporting AVX2 **/
+
+GENH5_TARGET("avx2,f16c") void
+f16cFloatToHalf(float const* src, uint16_t* dst, size_t n)
+{
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(src + i),
+                                    _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), h);
+    }
+    floatToHalfScalar(src + i, dst + i, n - i);
+}
+
+GENH5_TARGET("avx2,f16c") void
+f16cHalfToFloat(uint16_t const* src, float* dst, size_t n)
+{
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        __m128i h = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+    }
+    halfToFloatScalar(src + i, dst + i, n - i);
+}
+
+constexpr Kernels s_avx2Kernels{
+    avx2DoubleToFloat,
+    avx2FloatToDouble,
+    avx2Int64ToInt32,
+    avx2Int32ToInt64,
+    avx2Uint64ToUint32,
+    avx2Uint32ToUint64,
+    avx2ByteSwap<uint16_t>,
+    avx2ByteSwap<uint32_t>,
+    avx2ByteSwap<uint64_t>,
+    avx2PackBits,
+    avx2UnpackBits,
+    f16cFloatToHalf,
+    f16cHalfToFloat
+};
+
+/// whether the cpu and the os support avx2 and f16c
+bool
+hasAvx2()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+
+    // os must save the ymm registers
+    __cpuid(info, 1);
+    bool const osxsave = (info[2] & (1 << 27)) != 0;
+    bool const f16c = (info[2] & (1 << 29)) != 0;
+    if (!osxsave || !f16c || (_xgetbv(0) & 6) != 6) return false;
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    unsigned eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(ecx & bit_F16C))
+    {
+        return false;
+    }
+
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+/// whether the cpu supports sse2 (always the case on x86-64)
+bool
+hasSse2()
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    return true;
+#elif defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[3] & (1 << 26)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+#endif
+}
+
+#endif // GENH5_SIMD_X86
+
+#ifdef GENH5_SIMD_NEON
+
+/** NEON kernels **/
+
+void
+neonDoubleToFloat(double const* src, float* dst, size_t n)
+{
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+    {
+        vst1_f32(dst + i, vcvt_f32_f64(vld1q_f64(src + i)));
+    }
+    convertScalar(src + i, dst + i, n - i);
+}
+
+void
+neonFloatToDouble(float const* src, double* dst, size_t n)
+{
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+    {
+        vst1q_f64(dst + i, vcvt_f64_f32(vld1_f32(src + i)));
+    }
+    convertScalar(src + i, dst + i, n - i);
+}
+
+void
+neonInt64ToInt32(int64_t const* src, int32_t* dst, size_t n)
+{
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+    {
+        vst1_s32(dst + i, vqmovn_s64(vld1q_s64(src + i)));
+    }
+    saturateScalar(src + i, dst + i, n - i);
+}
+
+void
+neonInt32ToInt64(int32_t const* src, int64_t* dst, size_t n)
+{
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+    {
+        vst1q_s64(dst + i, vmovl_s32(vld1_s32(src + i)));
+    }
+    convertScalar(src + i, dst + i, n - i);
+}
+
+void
+neonUint64ToUint32(uint64_t const* src, uint32_t* dst, size_t n)
+{
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+    {
+        vst1_u32(dst + i, vqmovn_u64(vld1q_u64(src + i)));
+    }
+    saturateScalar(src + i, dst + i, n - i);
+}
+
+void
+neonUint32ToUint64(uint32_t const* src, uint64_t* dst, size_t n)
+{
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+    {
+        vst1q_u64(dst + i, vmovl_u32(vld1_u32(src + i)));
+    }
+    convertScalar(src + i, dst + i, n - i);
+}
+
+template <typename T, uint8x16_t (*Reverse)(uint8x16_t)>
+void
+neonByteSwap(void* data, size_t n)
+{
+    constexpr size_t perVector = 16 / sizeof(T);
+
+    auto* d = static_cast<uint8_t*>(data);
+    size_t i = 0;
+    for (; i + perVector <= n; i += perVector, d += 16)
+    {
+        vst1q_u8(d, Reverse(vld1q_u8(d)));
+    }
+    byteSwapScalar<T>(static_cast<T*>(data) + i, n - i);
+}
+
+inline uint8x16_t neonRev16(uint8x16_t v) { return vrev16q_u8(v); }
+inline uint8x16_t neonRev32(uint8x16_t v) { return vrev32q_u8(v); }
+inline uint8x16_t neonRev64(uint8x16_t v) { return vrev64q_u8(v); }
+
+void
+neonPackBits(bool const* src, uint8_t* dst, size_t n)
+{
+    uint8x16_t const weights = {1, 2, 4, 8, 16, 32, 64, 128,
+                                1, 2, 4, 8, 16, 32, 64, 128};
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        uint8x16_t v = vld1q_u8(reinterpret_cast<uint8_t const*>(src + i));
+        v = vandq_u8(vtstq_u8(v, v), weights);
+        dst[i / 8] = vaddv_u8(vget_low_u8(v));
+        dst[i / 8 + 1] = vaddv_u8(vget_high_u8(v));
+    }
+    packBitsScalar(src + i, dst + i / 8, n - i);
+}
+
+void
+neonUnpackBits(uint8_t const* src, bool* dst, size_t n)
+{
+    uint8x16_t const weights = {1, 2, 4, 8, 16, 32, 64, 128,
+                                1, 2, 4, 8, 16, 32, 64, 128};
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        uint8x16_t v = vcombine_u8(vdup_n_u8(src[i / 8]),
+                                   vdup_n_u8(src[i / 8 + 1]));
+        v = vshrq_n_u8(vtstq_u8(v, weights), 7);
+        vst1q_u8(reinterpret_cast<uint8_t*>(dst + i), v);
+    }
+    unpackBitsScalar(src + i / 8, dst + i, n - i);
+}
+
+void
+neonFloatToHalf(float const* src, uint16_t* dst, size_t n)
+{
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        vst1_u16(dst + i,
+                 vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i))));
+    }
+    floatToHalfScalar(src + i, dst + i, n - i);
+}
+
+void
+neonHalfToFloat(uint16_t const* src, float* dst, size_t n)
+{
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        vst1q_f32(dst + i,
+                  vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i))));
+    }
+    halfToFloatScalar(src + i, dst + i, n - i);
+}
+
+constexpr Kernels s_neonKernels{
+    neonDoubleToFloat,
+    neonFloatToDouble,
+    neonInt64ToInt32,
+    neonInt32ToInt64,
+    neonUint64ToUint32,
+    neonUint32ToUint64,
+    neonByteSwap<uint16_t, neonRev16>,
+    neonByteSwap<uint32_t, neonRev32>,
+    neonByteSwap<uint64_t, neonRev64>,
+    neonPackBits,
+    neonUnpackBits,
+    neonFloatToHalf,
+    neonHalfToFloat
+};
+
+#endif // GENH5_SIMD_NEON
+
+/// simd level in use, negative if not yet initialized
+std::atomic<int> s_simdLevel{-1};
+
+Kernels const&
+kernels() noexcept
+{
+    switch (GenH5::simdLevel())
+    {
+#ifdef GENH5_SIMD_X86
+    case GenH5::SimdAvx2:
+        return s_avx2Kernels;
+    case GenH5::SimdSse2:
+        return s_sse2Kernels;
+#endif
+#ifdef GENH5_SIMD_NEON
+    case GenH5::SimdNeon:
+        return s_neonKernels;
+#endif
+    default:
+        return s_scalarKernels;
+    }
+}
+
+/// properties of a standard integer or IEEE float type
+struct NumericType
+{
+    H5T_class_t typeClass{H5T_NO_CLASS};
+    size_t size{0};
+    H5T_sign_t sign{H5T_SGN_ERROR};
+    H5T_order_t order{H5T_ORDER_ERROR};
+
+    bool isValid() const { return typeClass != H5T_NO_CLASS; }
+};
+
+NumericType
+numericType(hid_t id) noexcept
+{
+    NumericType type;
+
+    H5T_class_t const typeClass = H5Tget_class(id);
+    size_t const size = H5Tget_size(id);
+    H5T_order_t const order = H5Tget_order(id);
+
+    if (order != H5T_ORDER_LE && order != H5T_ORDER_BE) return type;
+
+    switch (typeClass)
+    {
+    case H5T_INTEGER:
+        // no padding bits
+        if ((size != 2 && size != 4 && size != 8) ||
+            H5Tget_precision(id) != 8 * size || H5Tget_offset(id) != 0)
+        {
+            return type;
+        }
+        type.sign = H5Tget_sign(id);
+        break;
+    case H5T_FLOAT:
+    {
+        hid_t const le = size == 4 ? H5T_IEEE_F32LE : H5T_IEEE_F64LE;
+        hid_t const be = size == 4 ? H5T_IEEE_F32BE : H5T_IEEE_F64BE;
+        if ((size != 4 && size != 8) ||
+            (H5Tequal(id, le) <= 0 && H5Tequal(id, be) <= 0))
+        {
+            return type;
+        }
+        break;
+    }
+    default:
+        return type;
+    }
+
+    type.typeClass = typeClass;
+    type.size = size;
+    type.order = order;
+    return type;
+}
+
+/// whether the datatypes can be converted, i.e. are of the same kind and
+/// differ in size (8 and 4 bytes) or byte order
+bool
+isConvertible(NumericType const& src, NumericType const& dst) noexcept
+{
+    if (!src.isValid() || !dst.isValid() ||
+        src.typeClass != dst.typeClass || src.sign != dst.sign)
+    {
+        return false;
+    }
+
+    if (src.size == dst.size) return src.order != dst.order;
+
+    return (src.size == 8 && dst.size == 4) ||
+           (src.size == 4 && dst.size == 8);
+}
+
+void
+byteSwap(void* data, size_t size, size_t n) noexcept
+{
+    switch (size)
+    {
+    case 2:
+        return GenH5::details::byteSwap16(data, n);
+    case 4:
+        return GenH5::details::byteSwap32(data, n);
+    case 8:
+        return GenH5::details::byteSwap64(data, n);
+    }
+}
+
+/// converts elements of different size (in native byte order)
+void
+convertNative(void const* src, NumericType const& srcType,
+              void* dst, size_t n) noexcept
+{
+    using namespace GenH5::details;
+
+    bool const narrow = srcType.size == 8;
+
+    if (srcType.typeClass == H5T_FLOAT)
+    {
+        return narrow ?
+            doubleToFloat(static_cast<double const*>(src),
+                          static_cast<float*>(dst), n) :
+            floatToDouble(static_cast<float const*>(src),
+                          static_cast<double*>(dst), n);
+    }
+    if (srcType.sign == H5T_SGN_2)
+    {
+        return narrow ?
+            int64ToInt32(static_cast<int64_t const*>(src),
+                         static_cast<int32_t*>(dst), n) :
+            int32ToInt64(static_cast<int32_t const*>(src),
+                         static_cast<int64_t*>(dst), n);
+    }
+    return narrow ?
+        uint64ToUint32(static_cast<uint64_t const*>(src),
+                       static_cast<uint32_t*>(dst), n) :
+        uint32ToUint64(static_cast<uint32_t const*>(src),
+                       static_cast<uint64_t*>(dst), n);
+}
+
+/// number of elements converted at once if the source must be swapped
+constexpr size_t s_blockSize = 1024;
+
+} // namespace
+
+GenH5::SimdLevel
+GenH5::supportedSimdLevel() noexcept
+{
+    static SimdLevel const level = [](){
+#if defined(GENH5_SIMD_X86)
+        if (hasAvx2()) return SimdAvx2;
+        if (hasSse2()) return SimdSse2;
+#elif defined(GENH5_SIMD_NEON)
+        return SimdNeon;
+#endif
+        return SimdScalar;
+    }();
+    return level;
+}
+
+GenH5::SimdLevel
+GenH5::simdLevel() noexcept
+{
+    int level = s_simdLevel.load(std::memory_order_relaxed);
+    if (level < 0)
+    {
+        level = supportedSimdLevel();
+        s_simdLevel.store(level, std::memory_order_relaxed);
+    }
+    return static_cast<SimdLevel>(level);
+}
+
+void
+GenH5::setSimdLevel(SimdLevel level) noexcept(false)
+{
+    SimdLevel const supported = supportedSimdLevel();
+
+    bool const isSupported =
+            level == SimdScalar || level == supported ||
+            (level == SimdSse2 && supported == SimdAvx2);
+    if (!isSupported)
+    {
+        throw InvalidArgumentError{
+            GENH5_MAKE_EXECEPTION_STR() "Simd level not supported: " +
+            std::to_string(level)
+        };
+    }
+
+    s_simdLevel.store(level, std::memory_order_relaxed);
+}
+
+void
+GenH5::details::doubleToFloat(double const* src, float* dst,
+                              size_t n) noexcept
+{
+    kernels().doubleToFloat(src, dst, n);
+}
+
+void
+GenH5::details::floatToDouble(float const* src, double* dst,
+                              size_t n) noexcept
+{
+    kernels().floatToDouble(src, dst, n);
+}
+
+void
+GenH5::details::int64ToInt32(int64_t const* src, int32_t* dst,
+                             size_t n) noexcept
+{
+    kernels().int64ToInt32(src, dst, n);
+}
+
+void
+GenH5::details::int32ToInt64(int32_t const* src, int64_t* dst,
+                             size_t n) noexcept
+{
+    kernels().int32ToInt64(src, dst, n);
+}
+
+void
+GenH5::details::uint64ToUint32(uint64_t const* src, uint32_t* dst,
+                               size_t n) noexcept
+{
+    kernels().uint64ToUint32(src, dst, n);
+}
+
+void
+GenH5::details::uint32ToUint64(uint32_t const* src, uint64_t* dst,
+                               size_t n) noexcept
+{
+    kernels().uint32ToUint64(src, dst, n);
+}
+
+void
+GenH5::details::byteSwap16(void* data, size_t n) noexcept
+{
+    kernels().byteSwap16(data, n);
+}
+
+void
+GenH5::details::byteSwap32(void* data, size_t n) noexcept
+{
+    kernels().byteSwap32(data, n);
+}
+
+void
+GenH5::details::byteSwap64(void* data, size_t n) noexcept
+{
+    kernels().byteSwap64(data, n);
+}
+
+void
+GenH5::details::packBits(bool const* src, uint8_t* dst, size_t n) noexcept
+{
+    kernels().packBits(src, dst, n);
+}
+
+void
+GenH5::details::unpackBits(uint8_t const* src, bool* dst, size_t n) noexcept
+{
+    kernels().unpackBits(src, dst, n);
+}
+
+void
+GenH5::details::floatToHalf(float const* src, uint16_t* dst,
+                            size_t n) noexcept
+{
+    kernels().floatToHalf(src, dst, n);
+}
+
+void
+GenH5::details::halfToFloat(uint16_t const* src, float* dst,
+                            size_t n) noexcept
+{
+    kernels().halfToFloat(src, dst, n);
+}
+
+bool
+GenH5::details::isSimdConvertible(DataType const& src,
+                                  DataType const& dst) noexcept
+{
+    if (src.id() == dst.id()) return false;
+
+    // cheap tests first, most types are not convertible or need no conversion
+    H5T_class_t const typeClass = H5Tget_class(src.id());
+    if ((typeClass != H5T_INTEGER && typeClass != H5T_FLOAT) ||
+        H5Tget_class(dst.id()) != typeClass)
+    {
+        return false;
+    }
+    if (H5Tget_size(src.id()) == H5Tget_size(dst.id()) &&
+        H5Tget_order(src.id()) == H5Tget_order(dst.id()))
+    {
+        return false;
+    }
+
+    return isConvertible(numericType(src.id()), numericType(dst.id()));
+}
+
+bool
+GenH5::details::simdConvert(void const* src, DataType const& srcType,
+                            void* dst, DataType const& dstType,
+                            size_t n) noexcept
+{
+    NumericType const s = numericType(srcType.id());
+    NumericType const d = numericType(dstType.id());
+
+    if (!src || !dst || !isConvertible(s, d)) return false;
+
+    // only the byte order differs
+    if (s.size == d.size)
+    {
+        if (src != dst) std::memcpy(dst, src, n * s.size);
+        byteSwap(dst, s.size, n);
+        return true;
+    }
+
+    H5T_order_t const native = H5Tget_order(H5T_NATIVE_INT);
+    bool const swapSrc = s.order != native;
+    bool const swapDst = d.order != native;
+
+    auto const* srcBytes = static_cast<char const*>(src);
+    auto* dstBytes = static_cast<char*>(dst);
+
+    alignas(32) char buffer[s_blockSize * 8];
+
+    for (size_t begin = 0; begin < n; begin += s_blockSize)
+    {
+        size_t const count = std::min(s_blockSize, n - begin);
+
+        void const* in = srcBytes + begin * s.size;
+        void* out = dstBytes + begin * d.size;
+
+        if (swapSrc)
+        {
+            std::memcpy(buffer, in, count * s.size);
+            byteSwap(buffer, s.size, count);
+            in = buffer;
+        }
+
+        convertNative(in, s, out, count);
+
+        if (swapDst) byteSwap(out, d.size, count);
+    }
+
+    return true;
+}
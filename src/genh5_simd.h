@@ -0,0 +1,120 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#ifndef GENH5_SIMD_H
+#define GENH5_SIMD_H
+
+#include "genh5_exports.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace GenH5
+{
+
+class DataType;
+
+/**
+ * @brief The SimdLevel enum. Instruction set used by the conversion kernels.
+ */
+enum SimdLevel
+{
+    /// portable scalar code
+    SimdScalar = 0,
+    /// SSE2 (x86)
+    SimdSse2 = 1,
+    /// AVX2 and F16C (x86)
+    SimdAvx2 = 2,
+    /// NEON (ARM 64 bit)
+    SimdNeon = 3
+};
+
+/**
+ * @brief Best instruction set supported by the CPU. Is detected at runtime.
+ * @return simd level
+ */
+GENH5_EXPORT SimdLevel supportedSimdLevel() noexcept;
+
+/**
+ * @brief Instruction set used by the conversion kernels. Defaults to
+ * `supportedSimdLevel`.
+ * @return simd level
+ */
+GENH5_EXPORT SimdLevel simdLevel() noexcept;
+
+/**
+ * @brief Sets the instruction set used by the conversion kernels. Can be used
+ * to force the scalar implementation.
+ * @throws InvalidArgumentError if the level is not supported by the CPU
+ * @param level simd level
+ */
+GENH5_EXPORT void setSimdLevel(SimdLevel level) noexcept(false);
+
+namespace details
+{
+
+/** bulk conversions, dispatched to the kernels of `simdLevel`. Conversions
+ *  of doubles to floats round to nearest even, overflows become infinity.
+ *  Integer conversions saturate (like HDF5). **/
+GENH5_EXPORT void doubleToFloat(double const* src, float* dst,
+                                size_t n) noexcept;
+GENH5_EXPORT void floatToDouble(float const* src, double* dst,
+                                size_t n) noexcept;
+GENH5_EXPORT void int64ToInt32(int64_t const* src, int32_t* dst,
+                               size_t n) noexcept;
+GENH5_EXPORT void int32ToInt64(int32_t const* src, int64_t* dst,
+                               size_t n) noexcept;
+GENH5_EXPORT void uint64ToUint32(uint64_t const* src, uint32_t* dst,
+                                 size_t n) noexcept;
+GENH5_EXPORT void uint32ToUint64(uint32_t const* src, uint64_t* dst,
+                                 size_t n) noexcept;
+
+/** swaps the byte order of `n` elements in place **/
+GENH5_EXPORT void byteSwap16(void* data, size_t n) noexcept;
+GENH5_EXPORT void byteSwap32(void* data, size_t n) noexcept;
+GENH5_EXPORT void byteSwap64(void* data, size_t n) noexcept;
+
+/** packs `n` booleans into bits (least significant bit first), the
+ *  remaining bits of the last byte are set to zero **/
+GENH5_EXPORT void packBits(bool const* src, uint8_t* dst, size_t n) noexcept;
+/** unpacks `n` bits (least significant bit first) into booleans **/
+GENH5_EXPORT void unpackBits(uint8_t const* src, bool* dst, size_t n) noexcept;
+
+/**
+ * @brief Whether the elements can be converted between the datatypes using
+ * the conversion kernels. This is the case for standard floats and integers
+ * that differ in byte order or size (double and float, 64 and 32 bit
+ * integers of the same sign).
+ * @param src Source datatype
+ * @param dst Destination datatype
+ * @return Whether the datatypes can be converted
+ */
+GENH5_EXPORT bool isSimdConvertible(DataType const& src,
+                                    DataType const& dst) noexcept;
+
+/**
+ * @brief Converts `n` elements from `src` to `dst`. The datatypes must be
+ * convertible (see `isSimdConvertible`). The buffers may be identical if
+ * the datatypes have the same size.
+ * @param src Source buffer
+ * @param srcType Source datatype
+ * @param dst Destination buffer
+ * @param dstType Destination datatype
+ * @param n Number of elements
+ * @return success
+ */
+GENH5_EXPORT bool simdConvert(void const* src, DataType const& srcType,
+                              void* dst, DataType const& dstType,
+                              size_t n) noexcept;
+
+} // namespace details
+
+} // namespace GenH5
+
+#endif // GENH5_SIMD_H
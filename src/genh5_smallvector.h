@@ -0,0 +1,384 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#ifndef GENH5_SMALLVECTOR_H
+#define GENH5_SMALLVECTOR_H
+
+#include <QVector>
+#include <QDebug>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace GenH5
+{
+
+/**
+ * @brief The SmallVector class. Vector of trivially copyable elements, that
+ * stores up to `N` elements inline. Only if more elements are stored a buffer
+ * is allocated on the heap. The interface is compatible with `QVector`
+ * (i.e. Qt and STL style) and the vector is implicitly convertible from and
+ * to `QVector`.
+ */
+template <typename T, int N>
+class SmallVector
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "SmallVector requires a trivially copyable type");
+    static_assert(N > 0, "SmallVector requires an inline capacity");
+
+public:
+
+    using value_type             = T;
+    using size_type              = int;
+    using difference_type        = std::ptrdiff_t;
+    using reference              = T&;
+    using const_reference        = T const&;
+    using pointer                = T*;
+    using const_pointer          = T const*;
+    using iterator               = T*;
+    using const_iterator         = T const*;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /// number of elements stored inline
+    static constexpr int inlineCapacity = N;
+
+    SmallVector() noexcept = default;
+
+    /**
+     * @brief Vector of `size` value initialized elements
+     * @param size Size
+     */
+    explicit SmallVector(int size) : SmallVector(size, T{}) { }
+
+    /**
+     * @brief Vector of `size` elements initialized with `value`
+     * @param size Size
+     * @param value Value
+     */
+    SmallVector(int size, T const& value)
+    {
+        resize(size);
+        std::fill(begin(), end(), value);
+    }
+
+    SmallVector(std::initializer_list<T> list) :
+        SmallVector(list.begin(), list.end())
+    { }
+
+    template <typename InputIt,
+              typename = typename std::iterator_traits<InputIt>::iterator_category>
+    SmallVector(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first) push_back(static_cast<T>(*first));
+    }
+
+    // cppcheck-suppress noExplicitConstructor
+    SmallVector(QVector<T> const& vector) :
+        SmallVector(vector.cbegin(), vector.cend())
+    { }
+
+    SmallVector(SmallVector const& other) { assign(other); }
+
+    SmallVector(SmallVector&& other) noexcept { take(other); }
+
+    SmallVector& operator=(SmallVector const& other)
+    {
+        if (this != &other)
+        {
+            m_size = 0;
+            assign(other);
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept
+    {
+        if (this != &other)
+        {
+            m_heap.reset();
+            m_capacity = N;
+            take(other);
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(std::initializer_list<T> list)
+    {
+        clear();
+        for (T const& value : list) push_back(value);
+        return *this;
+    }
+
+    ~SmallVector() = default;
+
+    /** conversion **/
+    QVector<T> toVector() const
+    {
+        return QVector<T>(cbegin(), cend());
+    }
+
+    operator QVector<T>() const { return toVector(); }
+
+    /** size **/
+    int size() const noexcept { return m_size; }
+    int length() const noexcept { return m_size; }
+    int count() const noexcept { return m_size; }
+    int capacity() const noexcept { return m_capacity; }
+    bool empty() const noexcept { return m_size == 0; }
+    bool isEmpty() const noexcept { return m_size == 0; }
+
+    /**
+     * @brief Whether the elements are stored inline (i.e. no buffer was
+     * allocated)
+     * @return is inline
+     */
+    bool isInline() const noexcept { return !m_heap; }
+
+    /** element access **/
+    T* data() noexcept { return m_heap ? m_heap.get() : m_inline; }
+    T const* data() const noexcept { return m_heap ? m_heap.get() : m_inline; }
+    T const* constData() const noexcept { return data(); }
+
+    T& operator[](int i) { assert(i >= 0 && i < m_size); return data()[i]; }
+    T const& operator[](int i) const
+    {
+        assert(i >= 0 && i < m_size);
+        return data()[i];
+    }
+    T const& at(int i) const { return operator[](i); }
+
+    T value(int i, T const& defaultValue = T{}) const
+    {
+        return (i >= 0 && i < m_size) ? data()[i] : defaultValue;
+    }
+
+    T& front() { return operator[](0); }
+    T const& front() const { return operator[](0); }
+    T& first() { return front(); }
+    T const& first() const { return front(); }
+    T const& constFirst() const { return front(); }
+
+    T& back() { return operator[](m_size - 1); }
+    T const& back() const { return operator[](m_size - 1); }
+    T& last() { return back(); }
+    T const& last() const { return back(); }
+    T const& constLast() const { return back(); }
+
+    /** iterators **/
+    iterator begin() noexcept { return data(); }
+    const_iterator begin() const noexcept { return data(); }
+    const_iterator cbegin() const noexcept { return data(); }
+    const_iterator constBegin() const noexcept { return data(); }
+
+    iterator end() noexcept { return data() + m_size; }
+    const_iterator end() const noexcept { return data() + m_size; }
+    const_iterator cend() const noexcept { return data() + m_size; }
+    const_iterator constEnd() const noexcept { return data() + m_size; }
+
+    reverse_iterator rbegin() noexcept { return reverse_iterator{end()}; }
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator{end()};
+    }
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+
+    reverse_iterator rend() noexcept { return reverse_iterator{begin()}; }
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator{begin()};
+    }
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    /** modifiers **/
+    void reserve(int size)
+    {
+        if (size <= m_capacity) return;
+
+        std::unique_ptr<T[]> buffer{new T[size]};
+        if (m_size > 0)
+        {
+            std::memcpy(buffer.get(), data(), sizeof(T) * m_size);
+        }
+        m_heap = std::move(buffer);
+        m_capacity = size;
+    }
+
+    void resize(int size)
+    {
+        size = std::max(size, 0);
+        if (size > m_capacity) reserve(std::max(size, 2 * m_capacity));
+        // value initialize new elements
+        if (size > m_size) std::fill(data() + m_size, data() + size, T{});
+        m_size = size;
+    }
+
+    void clear() noexcept { m_size = 0; }
+
+    SmallVector& fill(T const& value, int size = -1)
+    {
+        if (size >= 0) resize(size);
+        std::fill(begin(), end(), value);
+        return *this;
+    }
+
+    void push_back(T const& value)
+    {
+        if (m_size == m_capacity)
+        {
+            // value may be an element of this vector
+            T copy = value;
+            reserve(2 * m_capacity);
+            data()[m_size++] = copy;
+            return;
+        }
+        data()[m_size++] = value;
+    }
+    void append(T const& value) { push_back(value); }
+    void prepend(T const& value) { insert(begin(), value); }
+
+    SmallVector& operator<<(T const& value)
+    {
+        push_back(value);
+        return *this;
+    }
+    SmallVector& operator+=(T const& value)
+    {
+        push_back(value);
+        return *this;
+    }
+
+    iterator insert(const_iterator pos, T const& value)
+    {
+        auto offset = pos - cbegin();
+        assert(offset >= 0 && offset <= m_size);
+
+        T copy = value;
+        push_back(copy);
+        std::rotate(begin() + offset, end() - 1, end());
+        return begin() + offset;
+    }
+
+    void pop_back() { assert(m_size > 0); --m_size; }
+    void removeLast() { pop_back(); }
+
+    void remove(int i, int n = 1)
+    {
+        assert(i >= 0 && n >= 0 && i + n <= m_size);
+        std::copy(begin() + i + n, end(), begin() + i);
+        m_size -= n;
+    }
+
+    /** lookup **/
+    int indexOf(T const& value) const
+    {
+        auto iter = std::find(cbegin(), cend(), value);
+        return iter == cend() ? -1 : static_cast<int>(iter - cbegin());
+    }
+
+    bool contains(T const& value) const { return indexOf(value) >= 0; }
+
+    SmallVector mid(int pos, int length = -1) const
+    {
+        pos = std::min(std::max(pos, 0), m_size);
+        int end = (length < 0) ? m_size : std::min(pos + length, m_size);
+        return SmallVector(cbegin() + pos, cbegin() + end);
+    }
+
+    /** comparison **/
+    friend bool operator==(SmallVector const& a, SmallVector const& b)
+    {
+        return a.m_size == b.m_size &&
+               std::equal(a.cbegin(), a.cend(), b.cbegin());
+    }
+    friend bool operator!=(SmallVector const& a, SmallVector const& b)
+    {
+        return !(a == b);
+    }
+    // exact overloads, otherwise comparisons with vectors would be ambiguous
+    friend bool operator==(SmallVector const& a, QVector<T> const& b)
+    {
+        return a.m_size == b.size() &&
+               std::equal(a.cbegin(), a.cend(), b.cbegin());
+    }
+    friend bool operator==(QVector<T> const& a, SmallVector const& b)
+    {
+        return b == a;
+    }
+    friend bool operator!=(SmallVector const& a, QVector<T> const& b)
+    {
+        return !(a == b);
+    }
+    friend bool operator!=(QVector<T> const& a, SmallVector const& b)
+    {
+        return !(b == a);
+    }
+
+private:
+
+    /// inline storage
+    T m_inline[N]{};
+    /// heap buffer, only allocated if the inline capacity is exceeded
+    std::unique_ptr<T[]> m_heap{};
+    int m_size{0};
+    int m_capacity{N};
+
+    /// copies the elements of other, assumes this vector is empty
+    void assign(SmallVector const& other)
+    {
+        reserve(other.m_size);
+        if (other.m_size > 0)
+        {
+            std::memcpy(data(), other.data(), sizeof(T) * other.m_size);
+        }
+        m_size = other.m_size;
+    }
+
+    /// takes the elements of other, assumes this vector has no heap buffer
+    void take(SmallVector& other) noexcept
+    {
+        if (other.m_heap)
+        {
+            m_heap = std::move(other.m_heap);
+            m_capacity = other.m_capacity;
+        }
+        else if (other.m_size > 0)
+        {
+            std::memcpy(m_inline, other.m_inline, sizeof(T) * other.m_size);
+        }
+        m_size = other.m_size;
+
+        other.m_size = 0;
+        other.m_capacity = N;
+    }
+};
+
+template <typename T, int N>
+inline QDebug
+operator<<(QDebug debug, SmallVector<T, N> const& vector)
+{
+    QDebugStateSaver save{debug};
+    debug.nospace() << "SmallVector(";
+    for (int i = 0; i < vector.size(); ++i)
+    {
+        if (i > 0) debug << ", ";
+        debug << vector[i];
+    }
+    return debug << ')';
+}
+
+} // namespace GenH5
+
+#endif // GENH5_SMALLVECTOR_H
@@ -11,6 +11,7 @@
 #define GENH5_TYPES_H
 
 #include "genh5_mpl.h"
+#include "genh5_smallvector.h"
 
 #include <tuple>
 #include <array>
@@ -147,6 +148,16 @@ enum IterationType
     FindRecursive = 1
 };
 
+/**
+ * @brief The CompoundLayout enum. Used to specify whether compound types are
+ * stored with or without padding between their members.
+ */
+enum CompoundLayout
+{
+    CompoundAligned = 0, // memory layout including padding
+    CompoundPacked = 1   // no padding (see `DataType::packed`)
+};
+
 /**
  * @brief The IterationFilter enum. Can be used to filter out certain object
  * type when iterating over child nodes.
@@ -165,8 +176,11 @@ using Vector = QVector<T>;
 // alias for strings
 using String = QByteArray;
 
-// alias for dimension vector type
-using Dimensions = Vector<hsize_t>;
+// number of dimensions stored inline by the dimension vector type
+constexpr int inline_rank = 8;
+
+// alias for dimension vector type (also used for indices)
+using Dimensions = SmallVector<hsize_t, inline_rank>;
 
 // alias for a compound type
 template <typename ...Ts>
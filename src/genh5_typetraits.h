@@ -12,6 +12,9 @@
 
 #include "genh5_typedefs.h"
 
+#include <type_traits>
+#include <utility>
+
 namespace GenH5
 {
 
@@ -112,6 +115,24 @@ template<typename T>
 struct has_template_type<T, enable_if_type_t<typename T::template_type>>:
         std::true_type {};
 
+// to check if Container stores its elements contiguously (i.e. data() exists)
+template<typename Container, class Enable = void>
+struct is_contiguous :
+        std::false_type {};
+
+template<typename Container>
+struct is_contiguous<Container, enable_if_type_t<
+        decltype(std::declval<Container&>().data())>> :
+        std::is_pointer<decltype(std::declval<Container&>().data())> {};
+
+// to check if the elements of Container can be copied bytewise into a
+// container of T (i.e. the conversion is the identity)
+template<typename Container, typename T>
+struct is_trivially_copyable_from :
+        std::integral_constant<bool,
+            std::is_same<value_t<Container>, T>::value &&
+            std::is_trivially_copyable<T>::value> {};
+
 // used to enable template if types differ
 template<typename T, typename U>
 using if_types_differ = std::enable_if_t<
@@ -44,7 +44,7 @@ prod(Container const& container)
 
 /** IDX **/
 inline hsize_t
-idx(Dimensions const& dims, Vector<hsize_t> const& idxs)
+idx(Dimensions const& dims, Dimensions const& idxs)
 {
     auto size = dims.size();
     if (size != idxs.size())
@@ -55,14 +55,11 @@ idx(Dimensions const& dims, Vector<hsize_t> const& idxs)
         };
     }
 
+    // row major
     hsize_t idx = 0;
     for (auto i = 0; i < size; ++i)
     {
-        idx += idxs[i] * std::accumulate(std::cbegin(dims) + i + 1,
-                                         std::cend(dims), 1ull,
-                                         [](auto prod, auto dim){
-            return prod * dim;
-        });
+        idx = idx * dims[i] + idxs[i];
     }
     return idx;
 }
@@ -0,0 +1,220 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+/*
+ * Tests counting heap allocations. Replaces the global allocation functions
+ * and is therefore built as a separate executable (H5AllocationTest).
+ */
+
+#include "gtest/gtest.h"
+
+#include "genh5_readcontext.h"
+#include "genh5_file.h"
+#include "genh5_group.h"
+
+#include "testhelper.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+
+/// number of heap allocations while counting is enabled
+std::atomic<size_t> s_allocations{0};
+std::atomic<bool> s_countAllocations{false};
+
+/// enables counting heap allocations for the scope of this object
+struct AllocationCounter
+{
+    AllocationCounter()
+    {
+        s_allocations = 0;
+        s_countAllocations = true;
+    }
+    ~AllocationCounter() { s_countAllocations = false; }
+
+    size_t count() const { return s_allocations; }
+};
+
+inline void*
+allocate(std::size_t size) noexcept
+{
+    if (s_countAllocations) ++s_allocations;
+    return std::malloc(size ? size : 1);
+}
+
+#ifdef __cpp_aligned_new
+inline void*
+allocate(std::size_t size, std::align_val_t align) noexcept
+{
+    if (s_countAllocations) ++s_allocations;
+    auto alignment = static_cast<std::size_t>(align);
+    if (alignment < sizeof(void*)) alignment = sizeof(void*);
+    // size must be a multiple of the alignment
+    size = (size + alignment - 1) / alignment * alignment;
+#ifdef _MSC_VER
+    return _aligned_malloc(size ? size : alignment, alignment);
+#else
+    void* ptr = nullptr;
+    return posix_memalign(&ptr, alignment, size ? size : alignment) == 0 ?
+                ptr : nullptr;
+#endif
+}
+
+inline void
+deallocateAligned(void* ptr) noexcept
+{
+#ifdef _MSC_VER
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+#endif
+
+} // namespace
+
+/** replaceable allocation functions **/
+void* operator new(std::size_t size)
+{
+    if (void* ptr = allocate(size)) return ptr;
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size)
+{
+    if (void* ptr = allocate(size)) return ptr;
+    throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, std::nothrow_t const&) noexcept
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size, std::nothrow_t const&) noexcept
+{
+    return allocate(size);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::nothrow_t const&) noexcept
+{
+    std::free(ptr);
+}
+void operator delete[](void* ptr, std::nothrow_t const&) noexcept
+{
+    std::free(ptr);
+}
+
+#ifdef __cpp_aligned_new
+void* operator new(std::size_t size, std::align_val_t align)
+{
+    if (void* ptr = allocate(size, align)) return ptr;
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size, std::align_val_t align)
+{
+    if (void* ptr = allocate(size, align)) return ptr;
+    throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, std::align_val_t align,
+                   std::nothrow_t const&) noexcept
+{
+    return allocate(size, align);
+}
+
+void* operator new[](std::size_t size, std::align_val_t align,
+                     std::nothrow_t const&) noexcept
+{
+    return allocate(size, align);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    deallocateAligned(ptr);
+}
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+    deallocateAligned(ptr);
+}
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    deallocateAligned(ptr);
+}
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    deallocateAligned(ptr);
+}
+void operator delete(void* ptr, std::align_val_t,
+                     std::nothrow_t const&) noexcept
+{
+    deallocateAligned(ptr);
+}
+void operator delete[](void* ptr, std::align_val_t,
+                       std::nothrow_t const&) noexcept
+{
+    deallocateAligned(ptr);
+}
+#endif
+
+/// This is a test fixture that does a init for each test
+class TestH5Allocations : public testing::Test
+{
+protected:
+
+    virtual void SetUp() override
+    {
+        file = GenH5::File(h5TestHelper->newFilePath(), GenH5::Create);
+        ASSERT_TRUE(file.isValid());
+
+        // 10 time steps of 6 values each
+        data = h5TestHelper->linearDataVector<double>(60, 0);
+        data.setDimensions({10, 6});
+        dset = file.root().writeDataSet(QByteArrayLiteral("steps"), data);
+        ASSERT_TRUE(dset.isValid());
+    }
+
+    GenH5::File file;
+    GenH5::DataSet dset;
+    GenH5::Data<double> data;
+};
+
+TEST_F(TestH5Allocations, counter)
+{
+    AllocationCounter counter;
+    delete new int{42};
+    delete[] new char[8];
+    EXPECT_EQ(counter.count(), 2);
+}
+
+TEST_F(TestH5Allocations, readContext)
+{
+    GenH5::ReadContext<double> context{dset, {1, 6}};
+    GenH5::Dimensions offset{0, 0};
+
+    // warm-up
+    ASSERT_TRUE(context.read(offset));
+
+    AllocationCounter counter;
+    for (GenH5::hsize_t t = 0; t < 10; ++t)
+    {
+        offset[0] = t;
+        if (!context.read(offset)) break;
+    }
+    EXPECT_EQ(counter.count(), 0);
+    EXPECT_EQ(context[5], data[9 * 6 + 5]);
+}
@@ -0,0 +1,148 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#include "gtest/gtest.h"
+#include "genh5_bitdata.h"
+#include "genh5_data.h"
+#include "genh5_exception.h"
+#include "genh5_file.h"
+#include "genh5_group.h"
+#include "genh5_simd.h"
+
+#include "testhelper.h"
+
+/// This is a test fixture that does a init for each test
+class TestH5BitData : public testing::Test
+{
+protected:
+
+    void TearDown() override
+    {
+        GenH5::setSimdLevel(GenH5::supportedSimdLevel());
+    }
+
+    /// pseudo random pattern
+    static GenH5::Vector<bool> pattern(int size)
+    {
+        GenH5::Vector<bool> values(size);
+        for (int i = 0; i < size; ++i) values[i] = (i * 7 + i / 3) % 5 < 2;
+        return values;
+    }
+};
+
+TEST_F(TestH5BitData, container)
+{
+    GenH5::BitData data{true, false, true, true, false, false, false, false,
+                        true, true};
+    EXPECT_EQ(data.size(), 10);
+    EXPECT_EQ(data.byteCount(), 2);
+    EXPECT_EQ(data.bytes()[0], 0x0d);
+    EXPECT_EQ(data.bytes()[1], 0x03);
+    EXPECT_EQ(data.count(), 5);
+    EXPECT_TRUE(data[2]);
+    EXPECT_FALSE(data.at(4));
+    EXPECT_THROW(data.at(10), GenH5::InvalidArgumentError);
+
+    data.set(4, true);
+    data.set(0, false);
+    EXPECT_EQ(data.bytes()[0], 0x1c);
+    EXPECT_THROW(data.set(10, true), GenH5::InvalidArgumentError);
+
+    // padding bits are zero
+    data.resize(3);
+    EXPECT_EQ(data.byteCount(), 1);
+    EXPECT_EQ(data.bytes()[0], 0x04);
+    EXPECT_TRUE(data == (GenH5::BitData{false, false, true}));
+
+    data.resize(20, true);
+    EXPECT_EQ(data.count(), 18);
+    EXPECT_EQ(data.bytes()[0], 0xfc);
+    EXPECT_EQ(data.bytes()[2], 0x0f);
+
+    GenH5::BitData ones(13, true);
+    EXPECT_EQ(ones.count(), 13);
+    EXPECT_TRUE(ones != GenH5::BitData(13));
+    EXPECT_TRUE(GenH5::BitData{}.isEmpty());
+
+    // the number of bytes is limited by the size of a vector
+    EXPECT_THROW(data.resize(GenH5::BitData::maxSize() + 1),
+                 GenH5::InvalidArgumentError);
+    EXPECT_EQ(data.size(), 20);
+}
+
+TEST_F(TestH5BitData, packAndUnpack)
+{
+    // odd number of elements to test the remaining elements
+    auto values = pattern(1003);
+
+    auto reference = GenH5::BitData::fromBools(values.constData(),
+                                               values.size());
+
+    for (auto level : {GenH5::SimdScalar, GenH5::supportedSimdLevel()})
+    {
+        SCOPED_TRACE(level);
+        GenH5::setSimdLevel(level);
+
+        auto data = GenH5::BitData::fromBools(values.constData(),
+                                              values.size());
+        EXPECT_TRUE(data == reference);
+        EXPECT_EQ(data.values(), values);
+
+        for (int i = 0; i < values.size(); ++i)
+        {
+            ASSERT_EQ(data[i], values[i]) << i;
+        }
+    }
+}
+
+TEST_F(TestH5BitData, dataset)
+{
+    GenH5::File file{h5TestHelper->newFilePath(), GenH5::Create};
+
+    auto values = pattern(1003);
+    auto data = GenH5::BitData::fromBools(values.constData(), values.size());
+
+    auto dset = GenH5::writeBitDataSet(file.root(), "mask", data);
+    EXPECT_TRUE(GenH5::isBitDataSet(dset));
+    EXPECT_EQ(dset.dataSpace().size(), 126);
+
+    auto read = GenH5::readBitDataSet(file.root().openDataSet("mask"));
+    EXPECT_TRUE(read == data);
+
+    // ranges on and off byte boundaries
+    for (size_t offset : {0, 1, 7, 8, 13, 500, 1000})
+    {
+        for (size_t count : {0, 1, 3, 8, 9, 100})
+        {
+            if (offset + count > data.size()) continue;
+
+            auto range = GenH5::readBitDataSet(dset, offset, count);
+            ASSERT_EQ(range.size(), count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                EXPECT_EQ(range[i], data[offset + i]) << offset << " " << i;
+            }
+            // padding bits are zero
+            EXPECT_TRUE(range == GenH5::BitData::fromBools(
+                            values.constData() + offset, count));
+        }
+    }
+
+    EXPECT_THROW(GenH5::readBitDataSet(dset, 1000, 4),
+                 GenH5::DataSetException);
+
+    // plain datasets do not hold packed bits
+    auto plain = file.root().writeDataSet("plain", GenH5::makeData(values));
+    EXPECT_FALSE(GenH5::isBitDataSet(plain));
+    EXPECT_THROW(GenH5::readBitDataSet(plain), GenH5::DataSetException);
+
+    // empty data
+    auto empty = GenH5::writeBitDataSet(file.root(), "empty", {});
+    EXPECT_TRUE(GenH5::readBitDataSet(empty).isEmpty());
+}
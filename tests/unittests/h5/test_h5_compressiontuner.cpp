@@ -0,0 +1,140 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#include "gtest/gtest.h"
+#include "genh5_compressiontuner.h"
+#include "genh5_data.h"
+#include "genh5_file.h"
+#include "genh5_group.h"
+
+#include "testhelper.h"
+
+#include <random>
+
+/// This is a test fixture that does a init for each test
+class TestH5CompressionTuner : public testing::Test
+{
+protected:
+
+    virtual void SetUp() override
+    {
+        // smooth and thus compressible data
+        GenH5::Vector<double> values;
+        values.reserve(200 * 100);
+        for (int i = 0; i < 200; ++i)
+        {
+            for (int j = 0; j < 100; ++j)
+            {
+                values.push_back(i * 0.25 + j);
+            }
+        }
+        data = GenH5::makeData(values);
+        data.setDimensions({200, 100});
+    }
+
+    GenH5::Data<double> data;
+};
+
+TEST_F(TestH5CompressionTuner, ratio)
+{
+    auto props = GenH5::tuneCompression(data, GenH5::GoalRatio);
+
+    EXPECT_TRUE(props.isChunked());
+    EXPECT_FALSE(props.filters().isEmpty());
+    EXPECT_EQ(props.chunkDimensions().size(), 2);
+
+    auto trial = GenH5::tuneCompression(data.dataWritePtr(), data.dataType(),
+                                        data.dataSpace(), data.dataSpace(),
+                                        GenH5::GoalRatio);
+    EXPECT_GT(trial.ratio, 2.0);
+    EXPECT_GT(trial.readTime, 0.0);
+}
+
+TEST_F(TestH5CompressionTuner, deterministic)
+{
+    auto tune = [&](GenH5::CompressionGoal goal, double throughput){
+        return GenH5::tuneCompression(data.dataWritePtr(), data.dataType(),
+                                      data.dataSpace(), data.dataSpace(),
+                                      goal, throughput);
+    };
+
+    // results depend only on the data and arguments
+    auto first = tune(GenH5::GoalBalanced, GenH5::defaultStorageThroughput);
+    auto second = tune(GenH5::GoalBalanced, GenH5::defaultStorageThroughput);
+    EXPECT_DOUBLE_EQ(first.ratio, second.ratio);
+    EXPECT_DOUBLE_EQ(first.readTime, second.readTime);
+    EXPECT_EQ(first.properties.filters().size(),
+              second.properties.filters().size());
+
+    // decompressing does not pay off for very fast storages
+    auto fast = tune(GenH5::GoalReadSpeed, 1e15);
+    EXPECT_TRUE(fast.properties.filters().isEmpty());
+
+    // slow storages benefit from compression
+    auto slow = tune(GenH5::GoalReadSpeed, 10.0 * (1 << 20));
+    EXPECT_FALSE(slow.properties.filters().isEmpty());
+
+    EXPECT_THROW(tune(GenH5::GoalBalanced, 0.0), GenH5::InvalidArgumentError);
+}
+
+TEST_F(TestH5CompressionTuner, targetDataSpace)
+{
+    // chunks are computed for the target dataspace
+    GenH5::DataSpace dspace(GenH5::Dimensions{200, 100},
+                            GenH5::Dimensions{GenH5::unlimited, 100});
+
+    auto props = GenH5::tuneCompression(data, GenH5::GoalBalanced, dspace);
+    EXPECT_TRUE(props.isChunked());
+
+    // rank must match
+    EXPECT_THROW(GenH5::tuneCompression(data, GenH5::GoalBalanced,
+                                        GenH5::DataSpace::linear(10)),
+                 GenH5::InvalidArgumentError);
+}
+
+TEST_F(TestH5CompressionTuner, incompressible)
+{
+    // random bytes cannot be compressed
+    std::mt19937 gen{42};
+    GenH5::Vector<unsigned char> values(10000);
+    for (auto& value : values) value = static_cast<unsigned char>(gen());
+
+    auto random = GenH5::makeData(values);
+    auto props = GenH5::tuneCompression(random, GenH5::GoalBalanced);
+    EXPECT_TRUE(props.filters().isEmpty());
+
+    // variable length data is not compressed
+    auto strings = GenH5::makeData(GenH5::Vector<QString>{"a", "b", "c"});
+    props = GenH5::tuneCompression(strings, GenH5::GoalRatio);
+    EXPECT_TRUE(props.filters().isEmpty());
+    EXPECT_FALSE(props.isChunked());
+}
+
+TEST_F(TestH5CompressionTuner, writeDataSet)
+{
+    GenH5::File file{h5TestHelper->newFilePath(), GenH5::Create};
+
+    auto dset = file.root().writeDataSet("tuned", data, GenH5::GoalRatio);
+    ASSERT_TRUE(dset.isValid());
+    EXPECT_TRUE(dset.cProperties().isChunked());
+    EXPECT_FALSE(dset.cProperties().filters().isEmpty());
+
+    GenH5::Data<double> read;
+    EXPECT_TRUE(dset.read(read));
+    EXPECT_EQ(read.values(), data.values());
+
+    // existing datasets are reused without tuning
+    auto plain = file.root().writeDataSet("plain", data);
+    EXPECT_TRUE(plain.cProperties().filters().isEmpty());
+
+    plain = file.root().writeDataSet("plain", data, GenH5::GoalRatio);
+    EXPECT_TRUE(plain.cProperties().filters().isEmpty());
+    EXPECT_TRUE(plain.read(read));
+    EXPECT_EQ(read.values(), data.values());
+}
@@ -17,6 +17,8 @@
 #include <QList>
 #include <QStringList>
 
+#include <vector>
+
 /// This is a test fixture that does a init for each test
 class TestH5Data : public testing::Test
 {
@@ -112,6 +114,41 @@ TEST_F(TestH5Data, sameConversionType)
     conversion<int>(d);
 }
 
+TEST_F(TestH5Data, trivialConversionType)
+{
+    static_assert(GenH5::traits::is_trivially_copyable_from<
+                      std::vector<double>, double>::value,
+                  "double should be trivially copyable");
+    static_assert(!GenH5::traits::is_trivially_copyable_from<
+                      QStringList, char*>::value,
+                  "QString should require a conversion");
+    static_assert(GenH5::traits::is_contiguous<std::vector<double>>::value,
+                  "std::vector should be contiguous");
+
+    // bulk copy from std::vector
+    std::vector<double> vec{1.5, 2.5, 3.5};
+    GenH5::Data<double> d{vec};
+    ASSERT_EQ(d.size(), 3);
+    EXPECT_TRUE(std::equal(std::cbegin(d), std::cend(d), std::cbegin(vec)));
+
+    // appends to existing data
+    d.push_back(doubleData);
+    ASSERT_EQ(d.size(), 3 + doubleData.size());
+    EXPECT_EQ(d.mid(3), doubleData);
+    d.push_back(std::vector<double>{});
+    EXPECT_EQ(d.size(), 3 + doubleData.size());
+
+    // bulk copy into std::vector
+    auto values = d.values<std::vector<double>>();
+    ASSERT_EQ(values.size(), d.size());
+    EXPECT_TRUE(std::equal(std::cbegin(d), std::cend(d), std::cbegin(values)));
+
+    // unpack appends as well
+    d.unpack(values);
+    EXPECT_EQ(values.size(), 2 * d.size());
+    EXPECT_EQ(values.back(), d.back());
+}
+
 TEST_F(TestH5Data, differentConversionType)
 {
     char val1[] = "MyString";
@@ -830,6 +867,66 @@ TEST_F(TestH5Data, compoundValueIdxTest)
     EXPECT_EQ(data.getValue<0>({1, 4, 1}), bas[1 * 20 + 4 * 4 + 1]);
 }
 
+TEST_F(TestH5Data, mdView)
+{
+    GenH5::Dimensions dims{2, 5, 4};
+
+    int size = GenH5::prod<int>(dims);
+    auto ints = h5TestHelper->linearDataVector<int>(size, 0, 1);
+
+    GenH5::Data<int> data{ints};
+
+    // no dimensions set
+    auto linear = data.view<1>();
+    EXPECT_EQ(linear.extent(0), size);
+    EXPECT_EQ(linear[7], ints[7]);
+    EXPECT_THROW(data.view<2>(), GenH5::InvalidArgumentError);
+
+    ASSERT_NO_THROW(data.setDimensions(dims));
+    EXPECT_THROW(data.view<2>(), GenH5::InvalidArgumentError);
+
+    // row major
+    auto view = data.view<3>();
+    EXPECT_EQ(view.size(), size);
+    EXPECT_EQ(view.data(), data.data());
+    EXPECT_EQ(view.stride(0), 20);
+    EXPECT_EQ(view.stride(2), 1);
+    EXPECT_TRUE(view.isContiguous());
+    EXPECT_EQ(view(1, 2, 3), ints[1 * 20 + 2 * 4 + 3]);
+    EXPECT_EQ(view(1, 2, 3), data.value({1, 2, 3}));
+    EXPECT_EQ((view[{1, 4, 1}]), data.value({1, 4, 1}));
+
+    // slicing
+    auto matrix = view.slice(1);
+    EXPECT_EQ(matrix.rank(), 2);
+    EXPECT_EQ(matrix(2, 3), view(1, 2, 3));
+    auto row = matrix.slice(4);
+    EXPECT_EQ(row.extent(0), 4);
+    EXPECT_EQ(row[1], view(1, 4, 1));
+
+    // writes through
+    view(0, 1, 2) = -1;
+    EXPECT_EQ(data.value({0, 1, 2}), -1);
+
+    // column major
+    auto const& cdata = data;
+    auto left = cdata.view<3>(GenH5::LayoutLeft);
+    EXPECT_EQ(left.stride(0), 1);
+    EXPECT_EQ(left.stride(2), 10);
+    EXPECT_TRUE(left.isContiguous());
+    EXPECT_EQ(left(1, 2, 3), ints[1 + 2 * 2 + 3 * 10]);
+
+    // slices of column major views are strided
+    auto strided = left.slice(1);
+    EXPECT_FALSE(strided.isContiguous());
+    EXPECT_EQ(strided(2, 3), left(1, 2, 3));
+
+    // views over data views
+    GenH5::DataView<int> dataView{data.data(), {10, 4}};
+    auto view2 = dataView.view<2>();
+    EXPECT_EQ(view2(3, 2), data[3 * 4 + 2]);
+}
+
 TEST_F(TestH5Data, dataspace)
 {
     GenH5::Data<QString> data;
@@ -0,0 +1,154 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#include "gtest/gtest.h"
+
+#include "genh5_data.h"
+#include "genh5_file.h"
+#include "genh5_group.h"
+#include "genh5_dataset.h"
+
+#include "testhelper.h"
+
+#include <QStringList>
+
+/// This is a test fixture that does a init for each test
+class TestH5ColumnData : public testing::Test
+{
+protected:
+
+    virtual void SetUp() override
+    {
+        intData    = GenH5::Vector<int>{1, 2, 3, 4, 5};
+        doubleData = GenH5::Vector<double>{.1, .2, .3, .4, .5};
+        stringData = QStringList{"a", "b", "c", "d", "e"};
+    }
+
+    GenH5::Vector<int> intData;
+    GenH5::Vector<double> doubleData;
+    QStringList stringData;
+};
+
+TEST_F(TestH5ColumnData, pushBack)
+{
+    GenH5::ColumnData<int, double, QString> data{intData, doubleData,
+                                                 stringData};
+    EXPECT_EQ(data.size(), intData.size());
+    EXPECT_TRUE(data.isConsistent());
+
+    // each column is contiguous
+    EXPECT_EQ(data.column<0>().values(), intData);
+    EXPECT_EQ(data.getValues<1>(), doubleData);
+    EXPECT_EQ((data.getValues<2, QStringList>()), stringData);
+
+    // single row
+    data.push_back(42, 4.2, QStringLiteral("f"));
+    EXPECT_EQ(data.size(), intData.size() + 1);
+    EXPECT_EQ(data.getValue<0>(5), 42);
+    EXPECT_EQ(data.getValue<1>(5), 4.2);
+    EXPECT_EQ(data.getValue<2>(5), QStringLiteral("f"));
+
+    // containers must have the same size
+    EXPECT_THROW(data.push_back(intData, doubleData, stringData.mid(1)),
+                 GenH5::InvalidArgumentError);
+    EXPECT_EQ(data.size(), intData.size() + 1);
+
+    data.clear();
+    EXPECT_TRUE(data.isEmpty());
+}
+
+TEST_F(TestH5ColumnData, datatype)
+{
+    auto data = GenH5::makeColumnData(intData, doubleData, stringData);
+    GenH5::CompData<int, double, QString> comp{intData, doubleData,
+                                               stringData};
+
+    // default names
+    EXPECT_EQ(data.memberName(1), QByteArray{"type_1"});
+    EXPECT_TRUE(data.dataType() == comp.dataType());
+
+    data.setTypeNames({"ints", "doubles", "strings"});
+    comp.setTypeNames({"ints", "doubles", "strings"});
+    EXPECT_TRUE(data.dataType() == comp.dataType());
+    EXPECT_TRUE(data.dataSpace() == comp.dataSpace());
+}
+
+TEST_F(TestH5ColumnData, readWrite)
+{
+    GenH5::File file(h5TestHelper->newFilePath(), GenH5::Create);
+    ASSERT_TRUE(file.isValid());
+
+    GenH5::ColumnData<int, double, QString> data{intData, doubleData,
+                                                 stringData};
+    data.setTypeNames({"ints", "doubles", "strings"});
+
+    auto dset = file.root().writeDataSet(QByteArrayLiteral("columns"), data);
+    ASSERT_TRUE(dset.isValid());
+    EXPECT_TRUE(dset.dataType().isCompound());
+
+    // read as column data
+    GenH5::ColumnData<int, double, QString> read;
+    read.setTypeNames(dset.dataType());
+    ASSERT_TRUE(dset.read(read));
+    EXPECT_EQ(read.getValues<0>(), intData);
+    EXPECT_EQ(read.getValues<1>(), doubleData);
+    EXPECT_EQ((read.getValues<2, QStringList>()), stringData);
+
+    // read as compound data
+    auto comp = file.root().readDataSet<int, double, QString>("columns");
+    EXPECT_EQ(comp.getValues<0>(), intData);
+    EXPECT_EQ(comp.getValues<1>(), doubleData);
+    EXPECT_EQ((comp.getValues<2, QStringList>()), stringData);
+
+    // subset of the members in a different order, other members are preserved
+    GenH5::Vector<int> ints{5, 4, 3, 2, 1};
+    GenH5::Vector<double> doubles{.5, .4, .3, .2, .1};
+    GenH5::ColumnData<double, int> subset{doubles, ints};
+    subset.setTypeNames({"doubles", "ints"});
+    EXPECT_TRUE(dset.write(subset));
+
+    comp = file.root().readDataSet<int, double, QString>("columns");
+    EXPECT_EQ(comp.getValues<0>(), ints);
+    EXPECT_EQ(comp.getValues<1>(), doubles);
+    EXPECT_EQ((comp.getValues<2, QStringList>()), stringData);
+
+    // unknown member
+    subset.setTypeNames({"doubles", "unknown"});
+    EXPECT_FALSE(dset.write(subset));
+
+    // inconsistent data
+    read.column<0>().push_back(42);
+    EXPECT_FALSE(read.isConsistent());
+    EXPECT_FALSE(dset.write(read));
+}
+
+TEST_F(TestH5ColumnData, writeMember)
+{
+    GenH5::File file(h5TestHelper->newFilePath(), GenH5::Create);
+    ASSERT_TRUE(file.isValid());
+
+    GenH5::CompData<int, double> data{intData, doubleData};
+    data.setTypeNames({"ints", "doubles"});
+
+    auto dset = file.root().writeDataSet(QByteArrayLiteral("comp"), data);
+    ASSERT_TRUE(dset.isValid());
+
+    // other members are preserved
+    GenH5::Vector<int> ints{5, 4, 3, 2, 1};
+    EXPECT_TRUE(dset.writeMember(QByteArrayLiteral("ints"), ints));
+
+    auto read = file.root().readDataSet<int, double>("comp");
+    EXPECT_EQ(read.getValues<0>(), ints);
+    EXPECT_EQ(read.getValues<1>(), doubleData);
+
+    // invalid member
+    EXPECT_FALSE(dset.writeMember(QByteArrayLiteral("unknown"), ints));
+    // too few elements
+    EXPECT_FALSE(dset.writeMember(QByteArrayLiteral("ints"), ints.mid(1)));
+}
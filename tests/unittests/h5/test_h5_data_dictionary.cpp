@@ -0,0 +1,150 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#include "gtest/gtest.h"
+
+#include "genh5_data/dictionary.h"
+#include "genh5_file.h"
+#include "genh5_group.h"
+#include "genh5_dataset.h"
+
+#include "testhelper.h"
+
+#include <QStringList>
+
+/// This is a test fixture that does a init for each test
+class TestH5DictionaryData : public testing::Test
+{
+protected:
+
+    virtual void SetUp() override
+    {
+        stringData = QStringList{"ok", "failed", "ok", "ok", "pending", "failed"};
+    }
+
+    QStringList stringData;
+};
+
+TEST_F(TestH5DictionaryData, intern)
+{
+    GenH5::DictionaryData<QString> data{stringData};
+
+    EXPECT_EQ(data.size(), stringData.size());
+    EXPECT_EQ(data.dictionarySize(), 3);
+    EXPECT_EQ(data.dictionary(), (QStringList{"ok", "failed", "pending"}));
+    EXPECT_EQ(data.codes(), (GenH5::Vector<uint16_t>{0, 1, 0, 0, 2, 1}));
+
+    // decode
+    EXPECT_EQ(data.values(), stringData);
+    EXPECT_EQ(data.value(4), QStringLiteral("pending"));
+    EXPECT_EQ(data.value<std::string>(1), "failed");
+
+    // filter by code
+    EXPECT_EQ(data.codeOf("failed"), 1);
+    EXPECT_EQ(data.codeOf("unknown"), -1);
+
+    // existing values are not added again
+    data.push_back(QStringLiteral("failed"));
+    data.push_back(QStringLiteral("unknown"));
+    EXPECT_EQ(data.size(), stringData.size() + 2);
+    EXPECT_EQ(data.dictionarySize(), 4);
+    EXPECT_EQ(data.code(data.size() - 2), 1);
+    EXPECT_EQ(data.code(data.size() - 1), 3);
+}
+
+TEST_F(TestH5DictionaryData, datatype)
+{
+    GenH5::DictionaryData<QString, uint8_t> data{stringData};
+
+    auto dtype = data.dataType();
+    EXPECT_TRUE(dtype.isEnum());
+    EXPECT_EQ(dtype.size(), sizeof(uint8_t));
+
+    auto members = dtype.enumMembers();
+    ASSERT_EQ(members.size(), 3);
+    EXPECT_EQ(members.at(0).name, QByteArray{"ok"});
+    EXPECT_EQ(members.at(0).value, 0);
+    EXPECT_EQ(members.at(2).name, QByteArray{"pending"});
+    EXPECT_EQ(members.at(2).value, 2);
+}
+
+TEST_F(TestH5DictionaryData, codeOverflow)
+{
+    GenH5::DictionaryData<QString, uint8_t> data;
+
+    for (int i = 0; i < 256; ++i)
+    {
+        data.push_back(QString::number(i));
+    }
+    EXPECT_EQ(data.dictionarySize(), 256);
+
+    EXPECT_THROW(data.push_back(QStringLiteral("256")),
+                 GenH5::InvalidArgumentError);
+}
+
+TEST_F(TestH5DictionaryData, emptyValue)
+{
+    GenH5::DictionaryData<QString> data;
+
+    // enum member names must not be empty
+    EXPECT_THROW(data.push_back(QString{}), GenH5::InvalidArgumentError);
+    EXPECT_TRUE(data.empty());
+    EXPECT_EQ(data.dictionarySize(), 0);
+}
+
+TEST_F(TestH5DictionaryData, readWrite)
+{
+    GenH5::File file(h5TestHelper->newFilePath(), GenH5::Create);
+    ASSERT_TRUE(file.isValid());
+
+    GenH5::DictionaryData<QString> data{stringData};
+
+    auto dset = file.root().writeDataSet(QByteArrayLiteral("status"), data);
+    EXPECT_TRUE(dset.dataType().isEnum());
+    EXPECT_EQ(dset.dataType().size(), sizeof(uint16_t));
+
+    GenH5::DictionaryData<QString> read;
+    ASSERT_TRUE(dset.read(read));
+
+    EXPECT_EQ(read.size(), data.size());
+    EXPECT_EQ(read.codes(), data.codes());
+    EXPECT_EQ(read.values(), stringData);
+
+    // interning continues using the dictionary read
+    read.push_back(QStringLiteral("pending"));
+    EXPECT_EQ(read.dictionarySize(), 3);
+}
+
+TEST_F(TestH5DictionaryData, readForeignEnum)
+{
+    GenH5::File file(h5TestHelper->newFilePath(), GenH5::Create);
+    ASSERT_TRUE(file.isValid());
+
+    // enum with arbitrary values
+    auto dtype = GenH5::DataType::enumeration(GenH5::DataType::Int(), {
+        {"low", 10}, {"high", 20}
+    });
+
+    auto dset = file.root().createDataSet(QByteArrayLiteral("level"), dtype,
+                                          GenH5::DataSpace::linear(3));
+    GenH5::Vector<int> values{20, 10, 20};
+    ASSERT_TRUE(dset.write(values.constData(), dtype));
+
+    // codes are mapped by name
+    GenH5::DictionaryData<QString, uint8_t> read;
+    ASSERT_TRUE(dset.read(read));
+    EXPECT_EQ(read.dictionary(), (QStringList{"low", "high"}));
+    EXPECT_EQ(read.codes(), (GenH5::Vector<uint8_t>{1, 0, 1}));
+    EXPECT_EQ(read.values(), (QStringList{"high", "low", "high"}));
+
+    // not an enum type
+    auto dset2 = file.root().writeDataSet(QByteArrayLiteral("strings"),
+                                          stringData);
+    EXPECT_FALSE(dset2.read(read));
+}
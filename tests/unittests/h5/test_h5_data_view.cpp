@@ -0,0 +1,97 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#include "gtest/gtest.h"
+
+#include "genh5_data/view.h"
+#include "genh5_file.h"
+#include "genh5_group.h"
+#include "genh5_dataset.h"
+
+#include "testhelper.h"
+
+#include <vector>
+
+/// This is a test fixture that does a init for each test
+class TestH5DataView : public testing::Test
+{
+protected:
+
+    virtual void SetUp() override
+    {
+        doubleData = {1.5, 2.5, 3.5, 4.5, 5.5, 6.5};
+
+        file = GenH5::File(h5TestHelper->newFilePath(), GenH5::Create);
+        ASSERT_TRUE(file.isValid());
+    }
+
+    GenH5::File file;
+
+    std::vector<double> doubleData;
+};
+
+TEST_F(TestH5DataView, view)
+{
+    GenH5::DataView<double> view{doubleData};
+    EXPECT_EQ(view.size(), doubleData.size());
+    EXPECT_EQ(view.data(), doubleData.data());
+    EXPECT_EQ(view[2], doubleData[2]);
+    EXPECT_TRUE(view.dataSpace() == GenH5::DataSpace::linear(6));
+
+    // dimensions
+    view.setDimensions({2, 3});
+    EXPECT_TRUE(view.dataSpace() == (GenH5::DataSpace{2, 3}));
+    EXPECT_THROW(view.setDimensions({2, 4}), GenH5::InvalidArgumentError);
+
+    GenH5::MutableDataView<double> mview{doubleData.data(), {3, 2}};
+    EXPECT_EQ(mview.size(), 6);
+    EXPECT_TRUE(mview.dataSpace() == (GenH5::DataSpace{3, 2}));
+
+    // writes through to the memory of the caller
+    mview[0] = 42;
+    EXPECT_EQ(doubleData[0], 42);
+
+    // views are contiguous themselves
+    GenH5::DataView<double> view2{mview};
+    EXPECT_EQ(view2.data(), doubleData.data());
+}
+
+TEST_F(TestH5DataView, readWrite)
+{
+    // write directly from std::vector
+    auto dset = file.root().writeDataSet(QByteArrayLiteral("view"),
+                                         GenH5::makeDataView(doubleData));
+    ASSERT_TRUE(dset.isValid());
+    EXPECT_EQ(dset.dataSpace().size(), doubleData.size());
+
+    // read directly into std::vector
+    std::vector<double> read(doubleData.size());
+    auto view = GenH5::makeMutableDataView(read);
+    ASSERT_TRUE(dset.read(view));
+    EXPECT_EQ(read, doubleData);
+
+    // memory cannot be grown
+    std::vector<double> tooSmall(doubleData.size() - 1);
+    GenH5::MutableDataView<double> view2{tooSmall};
+    EXPECT_FALSE(dset.read(view2));
+
+    // read-only view
+    GenH5::DataView<double> view3{read};
+    EXPECT_FALSE(dset.read(view3));
+
+    // write selection
+    std::vector<double> ones(3, 1.0);
+    GenH5::DataView<double> view4{ones};
+    auto selection = GenH5::makeSelection(dset.dataSpace(), {3});
+    EXPECT_TRUE(dset.write(view4, selection));
+
+    ASSERT_TRUE(dset.read(view));
+    EXPECT_EQ(read[0], 1.0);
+    EXPECT_EQ(read[3], doubleData[3]);
+}
@@ -17,6 +17,18 @@
 #include <QDebug>
 #include <QStringList>
 
+struct Sample
+{
+    double t;
+    float pos[3];
+    int id;
+};
+
+GENH5_DECLARE_COMPOUND_DATATYPE(Sample,
+                                GENH5_COMPOUND_MEMBER(Sample, t),
+                                GENH5_COMPOUND_MEMBER(Sample, pos),
+                                GENH5_COMPOUND_MEMBER_NAMED(Sample, id, "index"));
+
 /// This is a test fixture that does a init for each test
 class TestH5DataSet : public testing::Test
 {
@@ -120,10 +132,13 @@ TEST_F(TestH5DataSet, resize)
     auto group = file.root().createGroup(QByteArrayLiteral("group"));
     ASSERT_TRUE(group.isValid());
 
-    // create new dataset
+    // create new dataset (must be chunked)
     auto dset = group.createDataSet(QByteArrayLiteral("test"),
                                     doubleData.dataType(),
-                                    doubleData.dataSpace());
+                                    doubleData.dataSpace(),
+                                    GenH5::DataSetCProperties::autoChunked(
+                                        doubleData.dataSpace(),
+                                        doubleData.dataType()));
 
     // resize to zero
     EXPECT_TRUE(dset.resize({0}));
@@ -205,6 +220,204 @@ TEST_F(TestH5DataSet, readSelection)
     EXPECT_EQ(read.values(), dummy);
 }
 
+TEST_F(TestH5DataSet, readMember)
+{
+    GenH5::CompData<int, double, QString> data{intData.values(),
+                                               doubleData.values(),
+                                               stringData.values().mid(0, 5)};
+    data.setTypeNames({"ints", "doubles", "strings"});
+
+    auto dset = file.root().writeDataSet(QByteArrayLiteral("comp"), data);
+    ASSERT_TRUE(dset.isValid());
+
+    // single member into vector
+    GenH5::Vector<double> doubles;
+    EXPECT_TRUE(dset.readMember(QByteArrayLiteral("doubles"), doubles));
+    EXPECT_EQ(doubles, doubleData.values());
+
+    // single member using conversion
+    GenH5::Data<QString> strings;
+    EXPECT_TRUE(dset.readMember(QByteArrayLiteral("strings"), strings));
+    EXPECT_EQ(strings.values(), stringData.values().mid(0, 5));
+
+    // types requiring a conversion are read via a buffer
+    GenH5::Vector<QString> stringVector;
+    EXPECT_TRUE(dset.readMember(QByteArrayLiteral("strings"), stringVector));
+    EXPECT_EQ(stringVector, stringData.values().mid(0, 5));
+
+    // member type is converted
+    GenH5::Vector<double> ints;
+    EXPECT_TRUE(dset.readMember(QByteArrayLiteral("ints"), ints));
+    EXPECT_EQ(ints, doubleData.values());
+
+    // invalid member
+    EXPECT_FALSE(dset.readMember(QByteArrayLiteral("unknown"), doubles));
+
+    // not a compound dataset
+    auto dset2 = file.root().writeDataSet(QByteArrayLiteral("ints"), intData);
+    EXPECT_FALSE(dset2.readMember(QByteArrayLiteral("ints"), doubles));
+}
+
+TEST_F(TestH5DataSet, readMembers)
+{
+    GenH5::CompData<int, double, QString> data{intData.values(),
+                                               doubleData.values(),
+                                               stringData.values().mid(0, 5)};
+    data.setTypeNames({"ints", "doubles", "strings"});
+
+    auto dset = file.root().writeDataSet(QByteArrayLiteral("comp"), data);
+    ASSERT_TRUE(dset.isValid());
+
+    // subset in different order
+    auto read = dset.readMembers<QString, int>({"strings", "ints"});
+    EXPECT_EQ(read.size(), data.size());
+    EXPECT_EQ((read.getValues<0, QStringList>()),
+              stringData.values().mid(0, 5));
+    EXPECT_EQ(read.getValues<1>(), intData.values());
+
+    // invalid member
+    EXPECT_THROW((dset.readMembers<QString, int>({"strings", "unknown"})),
+                 GenH5::DataSetException);
+}
+
+TEST_F(TestH5DataSet, borrowedRef)
+{
+    auto dset = file.root().writeDataSet(QByteArrayLiteral("ints"), intData);
+    ASSERT_TRUE(dset.isValid());
+
+    int rc = GenH5::refCount(dset.id());
+
+    // reference count is not altered by refs
+    {
+        GenH5::DataSetRef ref{dset};
+        GenH5::DataSetRef copy = ref;
+        EXPECT_EQ(copy.id(), dset.id());
+        EXPECT_TRUE(copy.isValid());
+        EXPECT_EQ(GenH5::refCount(dset.id()), rc);
+
+        // owning object increments reference count
+        auto object = ref.toObject();
+        EXPECT_EQ(object.id(), dset.id());
+        EXPECT_EQ(GenH5::refCount(dset.id()), rc + 1);
+    }
+    EXPECT_EQ(GenH5::refCount(dset.id()), rc);
+
+    EXPECT_FALSE(GenH5::DataSetRef{}.isValid());
+
+    // retrieving the file does not leak a reference
+    int fileRc = GenH5::refCount(file.id());
+    {
+        auto f = dset.file();
+        EXPECT_EQ(f.id(), file.id());
+        EXPECT_EQ(GenH5::refCount(file.id()), fileRc + 1);
+    }
+    EXPECT_EQ(GenH5::refCount(file.id()), fileRc);
+
+    // reading and writing does not retain any references
+    GenH5::Data<int> read;
+    EXPECT_TRUE(dset.read(read));
+    EXPECT_EQ(read.values(), intData.values());
+    EXPECT_TRUE(dset.write(intData));
+    EXPECT_EQ(GenH5::refCount(dset.id()), rc);
+    EXPECT_EQ(GenH5::refCount(file.id()), fileRc);
+}
+
+TEST_F(TestH5DataSet, compoundStruct)
+{
+    auto dtype = GenH5::dataType<Sample>();
+    ASSERT_TRUE(dtype.isCompound());
+    EXPECT_EQ(dtype.size(), sizeof(Sample));
+
+    auto members = dtype.compoundMembers();
+    ASSERT_EQ(members.size(), 3);
+    EXPECT_EQ(members.at(0).name, QByteArray{"t"});
+    EXPECT_EQ(members.at(1).name, QByteArray{"pos"});
+    EXPECT_EQ(members.at(1).offset, offsetof(Sample, pos));
+    EXPECT_TRUE(members.at(1).type.isArray());
+    EXPECT_EQ(members.at(2).name, QByteArray{"index"});
+    EXPECT_EQ(members.at(2).offset, offsetof(Sample, id));
+
+    GenH5::Vector<Sample> samples{
+        {0.1, {1, 2, 3}, 1},
+        {0.2, {4, 5, 6}, 2},
+        {0.3, {7, 8, 9}, 3}
+    };
+
+    // written straight from the vector
+    auto dset = file.root().writeDataSet(QByteArrayLiteral("samples"), samples);
+    ASSERT_TRUE(dset.isValid());
+
+    GenH5::Data<Sample> read;
+    ASSERT_TRUE(dset.read(read));
+    ASSERT_EQ(read.size(), samples.size());
+    for (int i = 0; i < samples.size(); ++i)
+    {
+        EXPECT_EQ(read[i].t, samples[i].t);
+        EXPECT_EQ(read[i].pos[2], samples[i].pos[2]);
+        EXPECT_EQ(read[i].id, samples[i].id);
+    }
+
+    // members are accessible by name
+    GenH5::Vector<int> ids;
+    EXPECT_TRUE(dset.readMember(QByteArrayLiteral("index"), ids));
+    EXPECT_EQ(ids, (GenH5::Vector<int>{1, 2, 3}));
+}
+
+TEST_F(TestH5DataSet, packedCompound)
+{
+    GenH5::CompData<double, char, int> data{
+        doubleData.values(), GenH5::Vector<char>{'a', 'b', 'c', 'd', 'e'},
+        intData.values()
+    };
+    data.setTypeNames({"doubles", "chars", "ints"});
+
+    auto memType = data.dataType();
+    EXPECT_EQ(memType.size(), 16);
+
+    // padding is stored by default
+    auto aligned = file.root().writeDataSet(QByteArrayLiteral("aligned"), data);
+    EXPECT_EQ(aligned.dataType().size(), 16);
+
+    auto dset = file.root().writeDataSet(QByteArrayLiteral("packed"), data,
+                                         GenH5::CompoundPacked);
+    ASSERT_TRUE(dset.isValid());
+    EXPECT_EQ(dset.dataType().size(), 13);
+    EXPECT_TRUE(dset.dataType() == memType.packed());
+
+    // memory layout is still aligned
+    GenH5::CompData<double, char, int> read;
+    ASSERT_TRUE(dset.read(read));
+    EXPECT_EQ(read.getValues<0>(), data.getValues<0>());
+    EXPECT_EQ(read.getValues<1>(), data.getValues<1>());
+    EXPECT_EQ(read.getValues<2>(), data.getValues<2>());
+
+    auto read2 = file.root().readDataSet<double, char, int>(
+                QByteArrayLiteral("packed"));
+    EXPECT_EQ(read2.getValues<2>(), data.getValues<2>());
+
+    GenH5::Vector<int> ints;
+    EXPECT_TRUE(dset.readMember(QByteArrayLiteral("ints"), ints));
+    EXPECT_EQ(ints, intData.values());
+
+    // existing dataset is reused
+    auto dset2 = file.root().createDataSet(QByteArrayLiteral("packed"),
+                                           memType, data.dataSpace());
+    EXPECT_TRUE(dset2.dataType() == dset.dataType());
+    EXPECT_TRUE(dset2.write(data));
+
+    dset2 = file.root().writeDataSet(QByteArrayLiteral("packed"), data);
+    EXPECT_EQ(dset2.dataType().size(), 13);
+
+    // packed type passed explicitly
+    auto dset3 = file.root().createDataSet(QByteArrayLiteral("packed2"),
+                                           memType.packed(),
+                                           data.dataSpace());
+    EXPECT_EQ(dset3.dataType().size(), 13);
+    EXPECT_TRUE(dset3.write(data));
+    ASSERT_TRUE(dset3.read(read));
+    EXPECT_EQ(read.getValues<0>(), data.getValues<0>());
+}
+
 #if 0
 #include "genh5_reference.h"
 
@@ -14,6 +14,8 @@
 
 #include "testhelper.h"
 
+#include <H5Dpublic.h>
+
 /// This is a test fixture that does a init for each test
 class TestH5DataSetCProperties : public testing::Test
 {
@@ -48,15 +50,73 @@ TEST_F(TestH5DataSetCProperties, chunking)
 TEST_F(TestH5DataSetCProperties, autoChunk)
 {
     GenH5::DataSpace dspaceNull{};
-    EXPECT_EQ(GenH5::DataSetCProperties::autoChunk(dspaceNull),
+    EXPECT_EQ(GenH5::DataSetCProperties::autoChunk(dspaceNull,
+                                                   GenH5::DataType::Char()),
               GenH5::Dimensions{});
 
     // chunk dim may not be zero
     GenH5::DataSpace dspaceZero{0};
-    EXPECT_EQ(GenH5::DataSetCProperties::autoChunk(dspaceZero),
+    EXPECT_EQ(GenH5::DataSetCProperties::autoChunk(dspaceZero,
+                                                   GenH5::DataType::Char()),
               GenH5::Dimensions{1});
 }
 
+TEST_F(TestH5DataSetCProperties, autoChunkPolicy)
+{
+    using GenH5::DataSetCProperties;
+
+    EXPECT_EQ(DataSetCProperties::defaultChunkSize(), 1024u * 1024u);
+    EXPECT_THROW(DataSetCProperties::setDefaultChunkSize(0),
+                 GenH5::InvalidArgumentError);
+
+    // small datasets are stored in a single chunk
+    GenH5::DataSpace small{10, 20};
+    EXPECT_EQ(DataSetCProperties::autoChunk(small, GenH5::DataType::Double()),
+              (GenH5::Dimensions{10, 20}));
+
+    // chunks hold at most 1024 doubles (8 KiB)
+    GenH5::DataSpace large{1000, 1000};
+    size_t const chunkSize = 8 * 1024;
+
+    auto tiled = DataSetCProperties::autoChunk(
+                large, GenH5::DataType::Double(),
+                GenH5::ChunkTiled, chunkSize);
+    EXPECT_EQ(tiled, (GenH5::Dimensions{32, 32}));
+
+    auto rows = DataSetCProperties::autoChunk(
+                large, GenH5::DataType::Double(),
+                GenH5::ChunkRowWise, chunkSize);
+    EXPECT_EQ(rows, (GenH5::Dimensions{1, 1000}));
+
+    auto cols = DataSetCProperties::autoChunk(
+                large, GenH5::DataType::Double(),
+                GenH5::ChunkColumnWise, chunkSize);
+    EXPECT_EQ(cols, (GenH5::Dimensions{1000, 1}));
+
+    // unlimited dimensions may exceed the current extent
+    GenH5::DataSpace extendable{{0, 4}, {GenH5::unlimited, 4}};
+    auto chunk = DataSetCProperties::autoChunk(
+                extendable, GenH5::DataType::Double(),
+                GenH5::ChunkRowWise, chunkSize);
+    EXPECT_EQ(chunk, (GenH5::Dimensions{256, 4}));
+
+    // default chunk size is configurable
+    DataSetCProperties::setDefaultChunkSize(chunkSize);
+    EXPECT_EQ(DataSetCProperties::autoChunk(large, GenH5::DataType::Double()),
+              tiled);
+    DataSetCProperties::setDefaultChunkSize(1024 * 1024);
+
+    // used when creating datasets
+    GenH5::File file{h5TestHelper->newFilePath(), GenH5::Create};
+    auto dset = file.root().createDataSet(QByteArrayLiteral("extendable"),
+                                          GenH5::DataType::Double(),
+                                          extendable);
+    ASSERT_TRUE(dset.isValid());
+    EXPECT_TRUE(dset.cProperties().isChunked());
+    EXPECT_TRUE(dset.resize({100, 4}));
+    EXPECT_EQ(dset.dataSpace().dimensions(), (GenH5::Dimensions{100, 4}));
+}
+
 TEST_F(TestH5DataSetCProperties, compression)
 {
     EXPECT_FALSE(propDefault.isDeflated());
@@ -72,6 +132,223 @@ TEST_F(TestH5DataSetCProperties, compression)
     EXPECT_EQ(propCompressed.deflation(), 9);
 }
 
+TEST_F(TestH5DataSetCProperties, filters)
+{
+    EXPECT_TRUE(GenH5::isFilterAvailable(GenH5::FilterDeflate));
+    EXPECT_TRUE(GenH5::isFilterAvailable(GenH5::FilterShuffle));
+    EXPECT_TRUE(GenH5::isFilterAvailable(GenH5::FilterFletcher32));
+    EXPECT_FALSE(GenH5::isFilterAvailable(31999));
+
+    // dataset must be chunked
+    EXPECT_THROW(propDefault.setShuffle(), GenH5::PropertyListException);
+    EXPECT_THROW(propDefault.setFletcher32(), GenH5::PropertyListException);
+    EXPECT_TRUE(propDefault.filters().isEmpty());
+
+    // filters are ordered
+    propCompressed.setFletcher32();
+    propCompressed.setShuffle();
+    propCompressed.setScaleOffset(GenH5::ScaleInteger, 0);
+
+    auto filters = propCompressed.filters();
+    ASSERT_EQ(filters.size(), 4);
+    EXPECT_EQ(filters[0].id, GenH5::FilterScaleOffset);
+    EXPECT_EQ(filters[1].id, GenH5::FilterShuffle);
+    EXPECT_EQ(filters[2].id, GenH5::FilterDeflate);
+    EXPECT_EQ(filters[3].id, GenH5::FilterFletcher32);
+    EXPECT_FALSE(filters[3].name.isEmpty());
+
+    // parameters are kept
+    EXPECT_TRUE(filters[2].isOptional());
+    ASSERT_FALSE(filters[2].parameters.isEmpty());
+    EXPECT_EQ(filters[2].parameters.front(), 9);
+    EXPECT_EQ(propCompressed.deflation(), 9);
+
+    EXPECT_TRUE(propCompressed.hasFilter(GenH5::FilterShuffle));
+    EXPECT_FALSE(propCompressed.hasFilter(GenH5::FilterNBit));
+
+    propCompressed.clearFilters();
+    EXPECT_TRUE(propCompressed.filters().isEmpty());
+
+    // data can be written and read using the filters
+    GenH5::File file{h5TestHelper->newFilePath(), GenH5::Create};
+
+    GenH5::Data<int> data{h5TestHelper->linearDataVector<int>(100, 0, 3)};
+    GenH5::DataSetCProperties props{{10}, 5};
+    props.setShuffle();
+    props.setNBit();
+    props.setFletcher32();
+
+    auto dset = file.root().createDataSet(QByteArrayLiteral("filtered"),
+                                          data.dataType(), data.dataSpace(),
+                                          props);
+    ASSERT_TRUE(dset.isValid());
+    EXPECT_TRUE(dset.write(data));
+    EXPECT_EQ(dset.cProperties().filters().size(), 4);
+
+    GenH5::Data<int> read;
+    EXPECT_TRUE(dset.read(read));
+    EXPECT_EQ(read.values(), data.values());
+}
+
+namespace
+{
+
+/// writes and reads linear data using the properties specified
+void
+testFilterRoundTrip(GenH5::DataSetCProperties const& props, int filterId)
+{
+    GenH5::File file{h5TestHelper->newFilePath(), GenH5::Create};
+
+    GenH5::Data<double> data{
+        h5TestHelper->linearDataVector<double>(1000, 0, 0.5)
+    };
+
+    auto dset = file.root().createDataSet(QByteArrayLiteral("filtered"),
+                                          data.dataType(), data.dataSpace(),
+                                          props);
+    ASSERT_TRUE(dset.isValid());
+    EXPECT_TRUE(dset.write(data));
+    EXPECT_TRUE(dset.cProperties().hasFilter(filterId));
+
+    GenH5::Data<double> read;
+    EXPECT_TRUE(dset.read(read));
+    EXPECT_EQ(read.values(), data.values());
+}
+
+} // namespace
+
+TEST_F(TestH5DataSetCProperties, compressionFilters)
+{
+    // dataset must be chunked
+    EXPECT_THROW(propDefault.setLz4(), GenH5::PropertyListException);
+    EXPECT_THROW(propDefault.setZstd(), GenH5::PropertyListException);
+
+    // unavailable filters cannot be set
+    GenH5::DataSetCProperties props{GenH5::Dimensions{250}};
+    if (!GenH5::isFilterAvailable(GenH5::FilterLz4))
+    {
+        EXPECT_THROW(props.setLz4(), GenH5::PropertyListException);
+        EXPECT_THROW(props.setShuffleLz4(), GenH5::PropertyListException);
+    }
+    if (!GenH5::isFilterAvailable(GenH5::FilterZstd))
+    {
+        EXPECT_THROW(props.setZstd(), GenH5::PropertyListException);
+    }
+}
+
+TEST_F(TestH5DataSetCProperties, lz4)
+{
+    if (!GenH5::isFilterAvailable(GenH5::FilterLz4))
+    {
+        GTEST_SKIP() << "LZ4 filter not available";
+    }
+
+    // using multiple blocks per chunk
+    GenH5::DataSetCProperties props{GenH5::Dimensions{250}};
+    props.setLz4(256);
+    EXPECT_TRUE(props.hasFilter(GenH5::FilterLz4));
+
+    testFilterRoundTrip(props, GenH5::FilterLz4);
+}
+
+TEST_F(TestH5DataSetCProperties, shuffleLz4)
+{
+    if (!GenH5::isFilterAvailable(GenH5::FilterLz4))
+    {
+        GTEST_SKIP() << "LZ4 filter not available";
+    }
+
+    GenH5::DataSetCProperties props{GenH5::Dimensions{250}};
+    props.setShuffleLz4();
+    auto filters = props.filters();
+    ASSERT_EQ(filters.size(), 2);
+    EXPECT_EQ(filters[0].id, GenH5::FilterShuffle);
+    EXPECT_EQ(filters[1].id, GenH5::FilterLz4);
+
+    testFilterRoundTrip(props, GenH5::FilterLz4);
+}
+
+TEST_F(TestH5DataSetCProperties, zstd)
+{
+    if (!GenH5::isFilterAvailable(GenH5::FilterZstd))
+    {
+        GTEST_SKIP() << "Zstandard filter not available";
+    }
+
+    // invalid levels are clamped
+    GenH5::DataSetCProperties props{GenH5::Dimensions{250}};
+    props.setZstd(42);
+    auto filters = props.filters();
+    ASSERT_EQ(filters.size(), 1);
+    EXPECT_EQ(filters[0].parameters.value(0), 22);
+
+    testFilterRoundTrip(props, GenH5::FilterZstd);
+}
+
+TEST_F(TestH5DataSetCProperties, fillValue)
+{
+    EXPECT_FALSE(propDefault.hasFillValue());
+    EXPECT_EQ(propDefault.fillValue<int>().value(), 0);
+    EXPECT_EQ(propDefault.fillTime(), GenH5::FillIfSet);
+
+    GenH5::DataSetCProperties props{GenH5::Dimensions{5}};
+    props.setFillValue(42);
+    EXPECT_TRUE(props.hasFillValue());
+    EXPECT_EQ(props.fillValue<int>().value(), 42);
+    // converted
+    EXPECT_DOUBLE_EQ(props.fillValue<double>().value(), 42.0);
+
+    props.setFillValue(GenH5::makeData0D(7));
+    EXPECT_EQ(props.fillValue<int>().value(), 7);
+
+    // unwritten elements have the fill value
+    GenH5::File file{h5TestHelper->newFilePath(), GenH5::Create};
+
+    auto dset = file.root().createDataSet(QByteArrayLiteral("filled"),
+                                          GenH5::dataType<int>(),
+                                          GenH5::DataSpace::linear(10),
+                                          props);
+    ASSERT_TRUE(dset.isValid());
+    EXPECT_TRUE(dset.cProperties().hasFillValue());
+
+    GenH5::Data<int> read;
+    EXPECT_TRUE(dset.read(read));
+    EXPECT_EQ(read.values(), GenH5::Vector<int>(10, 7));
+}
+
+TEST_F(TestH5DataSetCProperties, fillAndAllocTime)
+{
+    GenH5::DataSetCProperties props{GenH5::Dimensions{5}};
+    props.setFillValue(1);
+    props.setFillTime(GenH5::FillNever);
+    props.setAllocTime(GenH5::AllocLate);
+    EXPECT_EQ(props.fillTime(), GenH5::FillNever);
+    EXPECT_EQ(props.allocTime(), GenH5::AllocLate);
+
+    props.setAllocTime(GenH5::AllocIncremental);
+    EXPECT_EQ(props.allocTime(), GenH5::AllocIncremental);
+
+    GenH5::File file{h5TestHelper->newFilePath(), GenH5::Create};
+
+    GenH5::Data<int> data{h5TestHelper->linearDataVector<int>(10)};
+    auto dset = file.root().createDataSet(QByteArrayLiteral("never"),
+                                          data.dataType(), data.dataSpace(),
+                                          props);
+    ASSERT_TRUE(dset.isValid());
+
+    // no storage is allocated before writing
+    EXPECT_EQ(H5Dget_storage_size(dset.id()), 0);
+    EXPECT_TRUE(dset.write(data));
+
+    auto cProps = dset.cProperties();
+    EXPECT_EQ(cProps.fillTime(), GenH5::FillNever);
+    EXPECT_EQ(cProps.allocTime(), GenH5::AllocIncremental);
+
+    GenH5::Data<int> read;
+    EXPECT_TRUE(dset.read(read));
+    EXPECT_EQ(read.values(), data.values());
+}
+
 TEST_F(TestH5DataSetCProperties, createDataSetOptionalParam)
 {
     GenH5::File file{h5TestHelper->newFilePath(), GenH5::Create};
@@ -85,12 +362,85 @@ TEST_F(TestH5DataSetCProperties, createDataSetOptionalParam)
 
     EXPECT_FALSE(dset1.cProperties().isChunked());
 
-    // optional is default -> by default dset will be chunked
+    // optional is default -> by default small dsets will be compact
     auto dset2 = file.root().createDataSet(
                                 QByteArrayLiteral("testB"),
                                 GenH5::DataType::VarString(),
                                 GenH5::DataSpace::linear(10),
                                 GenH5::Optional<GenH5::DataSetCProperties>{});
 
-    EXPECT_TRUE(dset2.cProperties().isChunked());
+    EXPECT_TRUE(dset2.cProperties().isCompact());
+}
+
+TEST_F(TestH5DataSetCProperties, layout)
+{
+    using GenH5::DataSetCProperties;
+
+    EXPECT_EQ(propDefault.layout(), GenH5::ContiguousLayout);
+    EXPECT_EQ(propChunked.layout(), GenH5::ChunkedLayout);
+
+    GenH5::DataSetCProperties props;
+    props.setLayout(GenH5::CompactLayout);
+    EXPECT_TRUE(props.isCompact());
+    props.setLayout(GenH5::ContiguousLayout);
+    EXPECT_TRUE(props.isContiguous());
+
+    // chunk dimensions must be set
+    EXPECT_THROW(props.setLayout(GenH5::ChunkedLayout),
+                 GenH5::PropertyListException);
+    // compression requires chunking
+    EXPECT_THROW(propCompressed.setLayout(GenH5::CompactLayout),
+                 GenH5::PropertyListException);
+
+    // default policy
+    auto dtype = GenH5::DataType::Double();
+    EXPECT_TRUE(DataSetCProperties::defaultProperties(
+                    GenH5::DataSpace::linear(3), dtype).isCompact());
+    EXPECT_TRUE(DataSetCProperties::defaultProperties(
+                    GenH5::DataSpace::Scalar(), dtype).isCompact());
+    EXPECT_TRUE(DataSetCProperties::defaultProperties(
+                    GenH5::DataSpace::linear(1000), dtype).isChunked());
+    EXPECT_TRUE(DataSetCProperties::defaultProperties(
+                    GenH5::DataSpace(GenH5::Dimensions{3},
+                                     GenH5::Dimensions{GenH5::unlimited}),
+                    dtype).isChunked());
+
+    EXPECT_TRUE(DataSetCProperties::defaultProperties(
+                    GenH5::DataSpace::linear(1000), dtype, 8000).isCompact());
+    EXPECT_THROW(DataSetCProperties::defaultProperties(
+                     GenH5::DataSpace::linear(3), dtype, 1024 * 1024),
+                 GenH5::InvalidArgumentError);
+    // compact layout disabled
+    EXPECT_TRUE(DataSetCProperties::defaultProperties(
+                    GenH5::DataSpace::linear(3), dtype, 0).isChunked());
+    EXPECT_TRUE(DataSetCProperties::defaultProperties(
+                    GenH5::DataSpace::Scalar(), dtype, 0).isContiguous());
+
+    // datasets using the default policy can be written and read
+    GenH5::File file{h5TestHelper->newFilePath(), GenH5::Create};
+    auto root = file.root();
+
+    auto small = root.writeDataSet(QByteArrayLiteral("small"),
+                                   GenH5::Vector<double>{1, 2, 3});
+    EXPECT_TRUE(small.cProperties().isCompact());
+
+    GenH5::Vector<double> values(1000, 42.0);
+    auto large = root.writeDataSet(QByteArrayLiteral("large"), values);
+    EXPECT_TRUE(large.cProperties().isChunked());
+
+    GenH5::Data<double> read;
+    EXPECT_TRUE(large.read(read));
+    EXPECT_EQ(read.values(), values);
+
+    // chunked datasets are resized in place
+    values.resize(500);
+    large = root.writeDataSet(QByteArrayLiteral("large"), values);
+    EXPECT_EQ(large.dataSpace().size(), 500);
+    EXPECT_TRUE(large.read(read));
+    EXPECT_EQ(read.values(), values);
+
+    // overwriting with a different size recreates the dataset
+    small = root.writeDataSet(QByteArrayLiteral("small"),
+                              GenH5::Vector<double>{1, 2, 3, 4});
+    EXPECT_EQ(small.dataSpace().size(), 4);
 }
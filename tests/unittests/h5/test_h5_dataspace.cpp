@@ -91,6 +91,21 @@ TEST_F(TestH5DataSpace, dimensions)
               (GenH5::Dimensions{1, 2, 3}));
 }
 
+TEST_F(TestH5DataSpace, maxDimensions)
+{
+    // not extendable by default
+    EXPECT_EQ((GenH5::DataSpace{1, 2, 3}.maxDimensions()),
+              (GenH5::Dimensions{1, 2, 3}));
+
+    GenH5::DataSpace space{{10, 2}, {GenH5::unlimited, 4}};
+    EXPECT_EQ(space.dimensions(), (GenH5::Dimensions{10, 2}));
+    EXPECT_EQ(space.maxDimensions(), (GenH5::Dimensions{GenH5::unlimited, 4}));
+
+    // length mismatch
+    EXPECT_THROW((GenH5::DataSpace{{10, 2}, {10}}),
+                 GenH5::DataSpaceException);
+}
+
 TEST_F(TestH5DataSpace, selection)
 {
     EXPECT_EQ(GenH5::DataSpace{}.selectionSize(), 0);
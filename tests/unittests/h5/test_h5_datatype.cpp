@@ -314,6 +314,31 @@ TEST_F(TestH5DataType, compound)
     EXPECT_TRUE(members2.at(1) == members.at(1));
 }
 
+TEST_F(TestH5DataType, packed)
+{
+    // int + padding + double
+    auto type = GenH5::dataType<int, double>({"a", "b"});
+    ASSERT_EQ(type.size(), sizeof(MyData));
+
+    auto packed = type.packed();
+    EXPECT_TRUE(packed.isCompound());
+    EXPECT_EQ(packed.size(), sizeof(int) + sizeof(double));
+    EXPECT_TRUE(packed != type);
+
+    auto members = packed.compoundMembers();
+    ASSERT_EQ(members.size(), 2);
+    EXPECT_EQ(members.at(1).name, QByteArray{"b"});
+    EXPECT_EQ(members.at(1).offset, sizeof(int));
+
+    // nested compound types are packed as well
+    auto array = GenH5::DataType::array(type, 3);
+    EXPECT_EQ(array.packed().size(), 3 * packed.size());
+
+    // nothing to pack
+    EXPECT_TRUE(dtypeDouble.packed() == dtypeDouble);
+    EXPECT_THROW(dtypeEmpty.packed(), GenH5::DataTypeException);
+}
+
 TEST_F(TestH5DataType, compoundInvalid)
 {
     // empty member list
@@ -340,6 +365,63 @@ TEST_F(TestH5DataType, compoundInvalid)
     }), GenH5::DataTypeException);
 }
 
+TEST_F(TestH5DataType, enumeration)
+{
+    GenH5::EnumMembers members{
+        {"red", 0},
+        {"green", 1},
+        {"blue", 42}
+    };
+
+    auto type = GenH5::DataType::enumeration(GenH5::DataType::UShort(),
+                                             members);
+
+    EXPECT_TRUE(type.isValid());
+    EXPECT_TRUE(type.isEnum());
+    EXPECT_FALSE(type.isInt());
+    EXPECT_EQ(type.size(), sizeof(unsigned short));
+    EXPECT_TRUE(type.superType() == GenH5::DataType::UShort());
+
+    auto members2 = type.enumMembers();
+    ASSERT_EQ(members2.length(), members.length());
+    EXPECT_TRUE(members2.at(0) == members.at(0));
+    EXPECT_TRUE(members2.at(1) == members.at(1));
+    EXPECT_TRUE(members2.at(2) == members.at(2));
+
+    // names and values are compared
+    EXPECT_TRUE(type == GenH5::DataType::enumeration(
+                    GenH5::DataType::UShort(), members));
+    EXPECT_FALSE(type == GenH5::DataType::enumeration(
+                     GenH5::DataType::UShort(),
+                     {{"red", 0}, {"green", 1}, {"yellow", 42}}));
+    EXPECT_FALSE(type == GenH5::DataType::enumeration(
+                     GenH5::DataType::UShort(),
+                     {{"red", 0}, {"green", 1}, {"blue", 2}}));
+
+    // not an enum
+    EXPECT_TRUE(dtypeInt.enumMembers().isEmpty());
+}
+
+TEST_F(TestH5DataType, enumerationInvalid)
+{
+    // invalid base type
+    EXPECT_THROW(GenH5::DataType::enumeration(GenH5::DataType::Double(),
+                                              {{"a", 0}}),
+                 GenH5::DataTypeException);
+    EXPECT_THROW(GenH5::DataType::enumeration(GenH5::DataType{}, {{"a", 0}}),
+                 GenH5::DataTypeException);
+
+    // duplicate name
+    EXPECT_THROW(GenH5::DataType::enumeration(GenH5::DataType::Int(),
+                                              {{"a", 0}, {"a", 1}}),
+                 GenH5::DataTypeException);
+
+    // duplicate value
+    EXPECT_THROW(GenH5::DataType::enumeration(GenH5::DataType::Int(),
+                                              {{"a", 0}, {"b", 0}}),
+                 GenH5::DataTypeException);
+}
+
 TEST_F(TestH5DataType, getTypeNames)
 {
     auto dtype = GenH5::DataType::compound(sizeof (MyData), {
@@ -588,3 +670,112 @@ TEST_F(TestH5DataType, equal_2)
     EXPECT_TRUE(dataType<Comp<double>>({"my_type_name"}) != dataType<Comp<float>>({"my_type_name"}));
     EXPECT_TRUE((dataType<double, int, VarLen<int>>() != dataType<VarLen<int>, int, double>()));
 }
+
+TEST_F(TestH5DataType, interned)
+{
+    using GenH5::details::internedDataTypeCount;
+
+    auto dtype = GenH5::dataType<int, double>({"a", "b"});
+    auto count = internedDataTypeCount();
+
+    // same type and names -> same id, nothing new is interned
+    for (int i = 0; i < 10; ++i)
+    {
+        auto other = GenH5::dataType<int, double>({"a", "b"});
+        EXPECT_EQ(dtype.id(), other.id());
+    }
+    EXPECT_EQ(internedDataTypeCount(), count);
+
+    // different names -> different type
+    auto dtypeNames = GenH5::dataType<int, double>({"a", "c"});
+    EXPECT_NE(dtype.id(), dtypeNames.id());
+    EXPECT_TRUE(dtype != dtypeNames);
+    EXPECT_EQ(internedDataTypeCount(), count + 1);
+
+    // arrays and varlen types are interned as well
+    EXPECT_EQ((GenH5::dataType<GenH5::Array<int, 3>>().id()),
+              (GenH5::dataType<GenH5::Array<int, 3>>().id()));
+    EXPECT_EQ(GenH5::dataType<GenH5::VarLen<float>>().id(),
+              GenH5::dataType<GenH5::VarLen<float>>().id());
+
+    // interned types are still equal to types created manually
+    auto manual = GenH5::DataType::compound(dtype.size(), {
+        {"a", 0, GenH5::DataType::Int()},
+        {"b", dtype.compoundMembers().at(1).offset, GenH5::DataType::Double()}
+    });
+    EXPECT_TRUE(dtype == manual);
+
+    // different C++ types with the same layout are interned separately but
+    // share the canonical id, i.e. are compared in constant time
+    struct Tag {};
+    auto tagged = GenH5::details::internedDataType<Tag>(
+                GenH5::CompoundNames<0>{}, [&](){
+        return GenH5::DataType::compound(manual.size(),
+                                         manual.compoundMembers());
+    });
+    EXPECT_NE(tagged.id(), dtype.id());
+    EXPECT_TRUE(tagged == dtype);
+    EXPECT_TRUE(dtype == tagged);
+    EXPECT_EQ(tagged.hash(), dtype.hash());
+    EXPECT_TRUE(tagged != dtypeNames);
+}
+
+TEST_F(TestH5DataType, internedBounded)
+{
+    using GenH5::details::internedDataTypeCount;
+    using GenH5::details::maxInternedNamedDataTypes;
+
+    auto count = internedDataTypeCount();
+
+    // member names chosen at runtime -> registry must not grow unbounded
+    size_t n = maxInternedNamedDataTypes() + 100;
+    for (size_t i = 0; i < n; ++i)
+    {
+        auto name = GenH5::String::number(static_cast<qulonglong>(i));
+        auto dtype = GenH5::dataType<int, double>({"a", name});
+        ASSERT_TRUE(dtype.isValid());
+        EXPECT_EQ(dtype.compoundMembers().at(1).name, name);
+    }
+
+    EXPECT_LE(internedDataTypeCount(), count + maxInternedNamedDataTypes());
+
+    // types that are not interned are released
+    GenH5::hid_t id = -1;
+    {
+        auto dtype = GenH5::dataType<int, double>({"a", "released"});
+        id = dtype.id();
+        EXPECT_TRUE(GenH5::isValidId(id));
+    }
+    EXPECT_FALSE(GenH5::isValidId(id));
+
+    // types that are not interned are still compared structurally
+    auto first  = GenH5::dataType<int, double>({"a", "not_interned"});
+    auto second = GenH5::dataType<int, double>({"a", "not_interned"});
+    EXPECT_TRUE(first == second);
+    EXPECT_EQ(first.hash(), second.hash());
+    EXPECT_TRUE((first != GenH5::dataType<int, double>({"a", "other"})));
+}
+
+TEST_F(TestH5DataType, hash)
+{
+    EXPECT_THROW(dtypeEmpty.hash(), GenH5::DataTypeException);
+
+    // equal types
+    EXPECT_EQ(dtypeInt.hash(), GenH5::DataType::Int().hash());
+    EXPECT_EQ(dtypeString.hash(), GenH5::DataType::VarString().hash());
+    EXPECT_EQ(GenH5::DataType::array(dtypeInt, 42).hash(),
+              GenH5::DataType::array(GenH5::DataType::Int(), 42).hash());
+    EXPECT_EQ((GenH5::dataType<int, double>({"a", "b"}).hash()),
+              (GenH5::dataType<int, double>({"a", "b"}).hash()));
+    EXPECT_EQ(GenH5::dataType<GenH5::VarLen<int>>().hash(),
+              GenH5::DataType::varLen(GenH5::DataType::Int()).hash());
+
+    // different types
+    EXPECT_NE(dtypeInt.hash(), dtypeDouble.hash());
+    EXPECT_NE(GenH5::DataType::array(dtypeInt, 42).hash(),
+              GenH5::DataType::array(dtypeInt, {21, 2}).hash());
+    EXPECT_NE((GenH5::dataType<int, double>({"a", "b"}).hash()),
+              (GenH5::dataType<int, double>({"a", "c"}).hash()));
+    EXPECT_NE(GenH5::dataType<GenH5::VarLen<int>>().hash(),
+              GenH5::dataType<GenH5::VarLen<double>>().hash());
+}
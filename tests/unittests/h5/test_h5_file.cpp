@@ -185,3 +185,80 @@ TEST_F(TestH5File, issue_147)
     }
     EXPECT_FALSE(GenH5::isValidId(fileId));
 }
+
+TEST_F(TestH5File, handleCache)
+{
+    GenH5::hid_t fileId = -1;
+    {
+        GenH5::File file{filePath, GenH5::Create};
+        fileId = file.id();
+
+        auto root = file.root();
+        auto group = root.createGroup("group");
+        group.createDataSet("a", GenH5::dataType<int>(),
+                            GenH5::DataSpace::linear(1));
+        group.createDataSet("b", GenH5::dataType<int>(),
+                            GenH5::DataSpace::linear(1));
+        group.createDataSet("c", GenH5::dataType<int>(),
+                            GenH5::DataSpace::linear(1));
+
+        // disabled by default
+        EXPECT_EQ(file.handleCacheCapacity(), 0);
+        EXPECT_NE(root.openDataSet("group/a").id(),
+                  root.openDataSet("group/a").id());
+
+        file.setHandleCacheCapacity(2);
+        EXPECT_EQ(file.handleCacheCapacity(), 2);
+        EXPECT_EQ(file.handleCacheSize(), 0);
+
+        // repeated opens return the cached object
+        auto a = root.openDataSet("group/a");
+        EXPECT_EQ(a.id(), root.openDataSet("group/a").id());
+        EXPECT_EQ(a.id(), group.openDataSet("a").id());
+        EXPECT_EQ(a.id(), root.openDataSet("/group/a").id());
+        EXPECT_EQ(file.handleCacheSize(), 1);
+
+        // cache is shared by file objects of the same file
+        EXPECT_EQ(root.file().handleCacheSize(), 1);
+
+        // type must match
+        EXPECT_THROW(root.openGroup("group/a"), GenH5::GroupException);
+
+        // least recently used object is evicted
+        auto g = root.openGroup("group");
+        EXPECT_EQ(g.id(), root.openGroup("group").id());
+        auto b = root.openDataSet("group/b");
+        EXPECT_EQ(file.handleCacheSize(), 2);
+        EXPECT_NE(a.id(), root.openDataSet("group/a").id());
+
+        // deleting invalidates the cache
+        b = root.openDataSet("group/b");
+        EXPECT_EQ(b.id(), root.openDataSet("group/b").id());
+        b.deleteLink();
+        EXPECT_THROW(root.openDataSet("group/b"), GenH5::DataSetException);
+
+        root.openDataSet("group/c");
+        EXPECT_GT(file.handleCacheSize(), 0);
+        g.deleteRecursively();
+        EXPECT_EQ(file.handleCacheSize(), 0);
+        EXPECT_THROW(root.openDataSet("group/c"), GenH5::DataSetException);
+
+        root.createGroup("other");
+        root.openGroup("other");
+        EXPECT_EQ(file.handleCacheSize(), 1);
+        file.clearHandleCache();
+        EXPECT_EQ(file.handleCacheSize(), 0);
+        EXPECT_EQ(file.handleCacheCapacity(), 2);
+
+        root.openGroup("other");
+        EXPECT_EQ(file.handleCacheSize(), 1);
+    }
+    // cache is cleared once the file is closed
+    EXPECT_FALSE(GenH5::isValidId(fileId));
+
+    // file can be opened again
+    GenH5::File file{filePath, GenH5::Open};
+    EXPECT_TRUE(file.isValid());
+    file.setHandleCacheCapacity(0);
+    EXPECT_EQ(file.handleCacheCapacity(), 0);
+}
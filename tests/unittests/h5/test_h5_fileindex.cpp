@@ -0,0 +1,221 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#include "gtest/gtest.h"
+#include "genh5_fileindex.h"
+
+#include "testhelper.h"
+
+/// This is a test fixture that does a init for each test
+class TestH5FileIndex : public testing::Test
+{
+protected:
+
+    virtual void SetUp() override
+    {
+        filePath = h5TestHelper->newFilePath();
+
+        GenH5::File file{filePath, GenH5::Create};
+        auto root = file.root();
+
+        auto a = root.createGroup("A");
+        a.createGroup("sub");
+        a.writeDataSet("sub/data", GenH5::makeData(GenH5::Vector<int>{1, 2, 3}));
+        root.createGroup("B");
+        root.writeDataSet("values", GenH5::makeData(GenH5::Vector<double>{4, 5}));
+    }
+
+    QByteArray filePath;
+};
+
+TEST_F(TestH5FileIndex, build)
+{
+    GenH5::File file{filePath, GenH5::Open};
+
+    GenH5::FileIndex index{file};
+    EXPECT_TRUE(index.isValid());
+    EXPECT_EQ(index.size(), 5);
+
+    EXPECT_TRUE(index.contains("A"));
+    EXPECT_TRUE(index.contains("/A/sub/"));
+    EXPECT_FALSE(index.contains("C"));
+
+    EXPECT_EQ(index.type("A/sub"), GenH5::IdType::Group);
+    EXPECT_EQ(index.type("A/sub/data"), GenH5::IdType::DataSet);
+    EXPECT_EQ(index.type("C"), GenH5::IdType::BadId);
+
+    // open objects using their token
+    auto dset = index.openDataSet("A/sub/data");
+    ASSERT_TRUE(dset.isValid());
+    GenH5::Data<int> data;
+    EXPECT_TRUE(dset.read(data));
+    EXPECT_EQ(data.values(), (GenH5::Vector<int>{1, 2, 3}));
+
+    EXPECT_TRUE(index.openGroup("B").isValid());
+
+    // invalid paths or types
+    EXPECT_THROW(index.openDataSet("C"), GenH5::LocationException);
+    EXPECT_THROW(index.openDataSet("A"), GenH5::LocationException);
+    EXPECT_THROW(index.openGroup("values"), GenH5::LocationException);
+
+    // removes subtree
+    EXPECT_EQ(index.remove("A"), 3);
+    EXPECT_EQ(index.size(), 2);
+    EXPECT_EQ(index.remove("values"), 1);
+    EXPECT_EQ(index.remove("values"), 0);
+    EXPECT_EQ(index.size(), 1);
+}
+
+TEST_F(TestH5FileIndex, incrementalUpdate)
+{
+    GenH5::File file{filePath, GenH5::Open};
+    auto root = file.root();
+
+    auto index = GenH5::registerFileIndex(file, false);
+    ASSERT_TRUE(index);
+    EXPECT_EQ(index.get(), GenH5::findFileIndex(file).get());
+    EXPECT_EQ(index->size(), 5);
+
+    // created nodes are added
+    auto c = root.createGroup("C");
+    c.createDataSet("dset", GenH5::dataType<int>(), GenH5::DataSpace::linear(2));
+    EXPECT_EQ(index->size(), 7);
+    EXPECT_EQ(index->type("C"), GenH5::IdType::Group);
+    EXPECT_EQ(index->type("C/dset"), GenH5::IdType::DataSet);
+    EXPECT_TRUE(index->openDataSet("C/dset").isValid());
+
+    // deleted nodes are removed
+    index->openDataSet("values").deleteLink();
+    EXPECT_FALSE(index->contains("values"));
+    root.openGroup("A").deleteRecursively();
+    EXPECT_FALSE(index->contains("A"));
+    EXPECT_FALSE(index->contains("A/sub/data"));
+    EXPECT_EQ(index->size(), 3);
+
+    EXPECT_TRUE(GenH5::clearFileIndex(file));
+    EXPECT_FALSE(GenH5::findFileIndex(file));
+    EXPECT_FALSE(GenH5::clearFileIndex(file));
+
+    // no longer updated
+    root.createGroup("D");
+    EXPECT_FALSE(index->contains("D"));
+
+    // index is unregistered and invalidated when closing the file
+    index = GenH5::registerFileIndex(file);
+    EXPECT_TRUE(index->isValid());
+    root = {};
+    file = {};
+    EXPECT_FALSE(index->isValid());
+    EXPECT_FALSE(index->verify());
+
+    GenH5::File other{h5TestHelper->newFilePath(), GenH5::Create};
+    EXPECT_FALSE(GenH5::findFileIndex(other));
+    other.root().createGroup("E");
+    EXPECT_FALSE(index->contains("E"));
+}
+
+TEST_F(TestH5FileIndex, sidecar)
+{
+    {
+        GenH5::File file{filePath, GenH5::Open};
+
+        GenH5::FileIndex index{file};
+        EXPECT_TRUE(index.save());
+        EXPECT_TRUE(file.root().exists(GenH5::FileIndex::sidecarName()));
+
+        // saving twice overwrites the sidecar
+        index.insert(GenH5::NodeInfo{"dummy", GenH5::IdType::Group});
+        EXPECT_TRUE(index.save());
+    }
+
+    GenH5::File file{filePath, GenH5::Open};
+
+    auto index = GenH5::FileIndex::load(file);
+    EXPECT_EQ(index.size(), 6);
+    EXPECT_EQ(index.type("dummy"), GenH5::IdType::Group);
+    EXPECT_EQ(index.type("A/sub/data"), GenH5::IdType::DataSet);
+    EXPECT_TRUE(index.openDataSet("A/sub/data").isValid());
+
+    // sidecar is not indexed
+    EXPECT_FALSE(GenH5::FileIndex{file}.contains(
+                     GenH5::FileIndex::sidecarName()));
+
+    // sidecar contains a node that does not exist
+    EXPECT_FALSE(index.verify());
+
+    // registering ignores an outdated sidecar
+    auto registered = GenH5::registerFileIndex(file, true);
+    EXPECT_FALSE(registered->contains("dummy"));
+    EXPECT_EQ(registered->size(), 5);
+    EXPECT_TRUE(registered->verify());
+    EXPECT_TRUE(registered->save());
+    EXPECT_TRUE(GenH5::clearFileIndex(file));
+
+    // up to date sidecar is used
+    EXPECT_TRUE(GenH5::FileIndex::load(file).verify());
+    registered = GenH5::registerFileIndex(file, true);
+    EXPECT_EQ(registered->size(), 5);
+    EXPECT_TRUE(GenH5::clearFileIndex(file));
+
+    // file changed without the index being registered
+    file.root().createGroup("C");
+    EXPECT_FALSE(GenH5::FileIndex::load(file).verify());
+    registered = GenH5::registerFileIndex(file, true);
+    EXPECT_TRUE(registered->contains("C"));
+    EXPECT_TRUE(registered->save());
+    EXPECT_TRUE(GenH5::clearFileIndex(file));
+
+    file.root().openDataSet("A/sub/data").deleteLink();
+    file.root().createGroup("A/sub/data");
+    EXPECT_FALSE(GenH5::FileIndex::load(file).verify());
+    registered = GenH5::registerFileIndex(file, true);
+    EXPECT_EQ(registered->type("A/sub/data"), GenH5::IdType::Group);
+    EXPECT_TRUE(GenH5::clearFileIndex(file));
+
+    // not used by default
+    registered = GenH5::registerFileIndex(file);
+    EXPECT_EQ(registered->type("A/sub/data"), GenH5::IdType::Group);
+    EXPECT_TRUE(GenH5::clearFileIndex(file));
+}
+
+TEST_F(TestH5FileIndex, sidecarSoftLink)
+{
+    GenH5::File file{filePath, GenH5::Open};
+
+    // soft links and committed datatypes are not indexed
+    ASSERT_GE(H5Lcreate_soft("/B", file.id(), "A/link",
+                             H5P_DEFAULT, H5P_DEFAULT), 0);
+    ASSERT_GE(H5Lcreate_soft("/values", file.id(), "values_link",
+                             H5P_DEFAULT, H5P_DEFAULT), 0);
+    GenH5::hid_t dtype = H5Tcopy(H5T_NATIVE_INT);
+    ASSERT_GE(H5Tcommit2(file.id(), "type", dtype,
+                         H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT), 0);
+    H5Tclose(dtype);
+
+    GenH5::FileIndex index{file};
+    EXPECT_EQ(index.size(), 5);
+    EXPECT_FALSE(index.contains("A/link"));
+    EXPECT_FALSE(index.contains("values_link"));
+    EXPECT_TRUE(index.verify());
+    EXPECT_TRUE(index.save());
+
+    // sidecar is still up to date
+    auto loaded = GenH5::FileIndex::load(file);
+    EXPECT_EQ(loaded.size(), 5);
+    EXPECT_TRUE(loaded.verify());
+
+    auto registered = GenH5::registerFileIndex(file, true);
+    EXPECT_EQ(registered->size(), 5);
+    EXPECT_TRUE(registered->openGroup("B").isValid());
+    EXPECT_TRUE(GenH5::clearFileIndex(file));
+
+    // adding a group is still detected
+    file.root().createGroup("A/C");
+    EXPECT_FALSE(GenH5::FileIndex::load(file).verify());
+}
@@ -0,0 +1,179 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#include "gtest/gtest.h"
+#include "genh5_float16.h"
+#include "genh5_data.h"
+#include "genh5_datatype.h"
+#include "genh5_file.h"
+#include "genh5_group.h"
+
+#include "testhelper.h"
+
+#include <H5Tpublic.h>
+
+#include <cmath>
+#include <limits>
+
+/// This is a test fixture that does a init for each test
+class TestH5Float16 : public testing::Test
+{
+protected:
+
+    static uint16_t bits(float value)
+    {
+        return GenH5::float16{value}.bits();
+    }
+};
+
+TEST_F(TestH5Float16, dataType)
+{
+    auto const& f16 = GenH5::DataType::Float16();
+    auto const& bf16 = GenH5::DataType::BFloat16();
+
+    EXPECT_TRUE(f16.isFloat());
+    EXPECT_EQ(f16.size(), 2);
+    EXPECT_EQ(bf16.size(), 2);
+    EXPECT_TRUE(f16 != bf16);
+    EXPECT_TRUE(f16 != GenH5::DataType::Float());
+
+    EXPECT_TRUE(GenH5::dataType<GenH5::float16>() == f16);
+    EXPECT_TRUE(GenH5::dataType<GenH5::bfloat16>() == bf16);
+}
+
+TEST_F(TestH5Float16, scalar)
+{
+    EXPECT_EQ(bits(0.f), 0x0000);
+    EXPECT_EQ(bits(-0.f), 0x8000);
+    EXPECT_EQ(bits(1.f), 0x3c00);
+    EXPECT_EQ(bits(-2.f), 0xc000);
+    EXPECT_EQ(bits(65504.f), 0x7bff);
+    // overflow
+    EXPECT_EQ(bits(65520.f), 0x7c00);
+    EXPECT_EQ(bits(std::numeric_limits<float>::infinity()), 0x7c00);
+    EXPECT_TRUE(std::isnan(float(GenH5::float16{std::nanf("")})));
+    // subnormals
+    EXPECT_EQ(bits(std::ldexp(1.f, -24)), 0x0001);
+    EXPECT_EQ(bits(std::ldexp(1.f, -26)), 0x0000);
+    EXPECT_FLOAT_EQ(GenH5::float16::fromBits(0x03ff), std::ldexp(1023.f, -24));
+    // ties are rounded to even
+    EXPECT_EQ(bits(1.f + std::ldexp(1.f, -11)), 0x3c00);
+    EXPECT_EQ(bits(1.f + 3 * std::ldexp(1.f, -11)), 0x3c02);
+
+    // double is rounded once
+    double const tie = 1.0 + std::ldexp(1.0, -11) + std::ldexp(1.0, -40);
+    EXPECT_EQ(GenH5::float16{tie}.bits(), 0x3c01);
+
+    EXPECT_EQ(GenH5::bfloat16{1.f}.bits(), 0x3f80);
+    EXPECT_FLOAT_EQ(GenH5::bfloat16{3.140625f}, 3.140625f);
+    EXPECT_TRUE(std::isnan(float(GenH5::bfloat16{std::nanf("")})));
+}
+
+TEST_F(TestH5Float16, conversionMatchesHdf5)
+{
+    GenH5::registerBuiltinConversions();
+
+    // built-in conversion is used instead of the soft conversion of HDF5
+    auto const& f16 = GenH5::DataType::Float16();
+    EXPECT_GT(H5Tcompiler_conv(H5T_NATIVE_DOUBLE, f16.id()), 0);
+    EXPECT_GT(H5Tcompiler_conv(f16.id(), H5T_NATIVE_FLOAT), 0);
+
+    // big endian half type is converted by HDF5
+    hid_t f16be = H5Tcopy(GenH5::DataType::Float16().id());
+    ASSERT_GE(H5Tset_order(f16be, H5T_ORDER_BE), 0);
+
+    GenH5::Vector<uint16_t> halfs(1 << 16);
+    for (int i = 0; i < halfs.size(); ++i) halfs[i] = static_cast<uint16_t>(i);
+
+    // widening is exact
+    GenH5::Vector<double> ours(halfs.size());
+    GenH5::details::halfToDouble(halfs.constData(), ours.data(), halfs.size());
+
+    // conversion is done in place, source elements are packed
+    GenH5::Vector<double> hdf5(halfs.size());
+    auto* buffer = reinterpret_cast<char*>(hdf5.data());
+    for (int i = 0; i < halfs.size(); ++i)
+    {
+        uint16_t swapped = static_cast<uint16_t>(halfs[i] << 8 | halfs[i] >> 8);
+        std::memcpy(buffer + i * sizeof(swapped), &swapped, sizeof(swapped));
+    }
+    ASSERT_GE(H5Tconvert(f16be, H5T_NATIVE_DOUBLE, hdf5.size(), hdf5.data(),
+                         nullptr, H5P_DEFAULT), 0);
+    H5Tclose(f16be);
+
+    for (int i = 0; i < halfs.size(); ++i)
+    {
+        if (std::isnan(hdf5[i]))
+        {
+            EXPECT_TRUE(std::isnan(ours[i]));
+            continue;
+        }
+        EXPECT_EQ(ours[i], hdf5[i]) << "bits: " << i;
+    }
+
+    // narrowing of representable values is exact
+    GenH5::Vector<uint16_t> back(halfs.size());
+    GenH5::details::doubleToHalf(ours.constData(), back.data(), ours.size());
+    for (int i = 0; i < halfs.size(); ++i)
+    {
+        if (std::isnan(ours[i])) continue;
+        EXPECT_EQ(back[i], halfs[i]);
+    }
+}
+
+TEST_F(TestH5Float16, dataset)
+{
+    GenH5::File file{h5TestHelper->newFilePath(), GenH5::Create};
+
+    GenH5::Data<double> data{
+        h5TestHelper->linearDataVector<double>(1000, -10, 0.1)
+    };
+
+    auto writeAndRead = [&](QByteArray const& name,
+                            GenH5::DataType const& dtype, double tolerance){
+        // double in memory, half precision in the file
+        auto dset = file.root().createDataSet(name, dtype, data.dataSpace());
+        ASSERT_TRUE(dset.isValid());
+        EXPECT_TRUE(dset.write(data));
+        EXPECT_TRUE(dset.dataType() == dtype);
+
+        GenH5::Data<double> read;
+        EXPECT_TRUE(dset.read(read));
+        ASSERT_EQ(read.size(), data.size());
+        for (int i = 0; i < data.size(); ++i)
+        {
+            EXPECT_NEAR(read[i], data[i],
+                        std::abs(data[i]) * tolerance + 1e-7);
+        }
+    };
+
+    writeAndRead("float16", GenH5::DataType::Float16(),
+                 std::ldexp(1.0, -11));
+    writeAndRead("bfloat16", GenH5::DataType::BFloat16(),
+                 std::ldexp(1.0, -8));
+
+    auto dset = file.root().openDataSet("float16");
+
+    // raw values
+    GenH5::Data<GenH5::float16> raw;
+    EXPECT_TRUE(dset.read(raw));
+    ASSERT_EQ(raw.size(), data.size());
+    for (int i = 0; i < data.size(); ++i)
+    {
+        EXPECT_EQ(raw[i].bits(), GenH5::float16{data[i]}.bits());
+    }
+
+    // float in memory
+    GenH5::Data<float> floats;
+    EXPECT_TRUE(dset.read(floats));
+    for (int i = 0; i < data.size(); ++i)
+    {
+        EXPECT_EQ(floats[i], float(raw[i]));
+    }
+}
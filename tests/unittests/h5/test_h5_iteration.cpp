@@ -56,6 +56,11 @@ protected:
         return -1;
     }
 
+    int pathDepth(QByteArray const& path)
+    {
+        return 1 + static_cast<int>(std::count(path.cbegin(), path.cend(), '/'));
+    }
+
     void checkNodes(GenH5::Vector<GenH5::NodeInfo> const& nodes,
                     GenH5::Group const& parent)
     {
@@ -230,3 +235,148 @@ TEST_F(TestH5Iteration, sample)
         return 0;
     }, GenH5::FindRecursive);
 }
+
+TEST_F(TestH5Iteration, findChildNodeNames)
+{
+    GenH5::File file{h5TestHelper->newFilePath(), GenH5::Create};
+    ASSERT_TRUE(file.isValid());
+
+    auto root = file.root();
+
+    EXPECT_TRUE(root.findChildNodeNames().empty());
+
+    createFileStructure(root);
+
+    // direct children only
+    auto direct = root.findChildNodeNames(GenH5::FindDirectOnly);
+    EXPECT_EQ(direct.size(),
+              countChildNodes(m_groups + m_dsets, GenH5::Group{}));
+
+    // all children
+    auto all = root.findChildNodeNames(GenH5::FindRecursive);
+    EXPECT_EQ(all.size(), m_groups.size() + m_dsets.size());
+
+    // names are the same as the paths of the node infos
+    auto nodes = root.findChildNodes(GenH5::FindRecursive);
+    ASSERT_EQ(nodes.size(), all.size());
+    for (int i = 0; i < nodes.size(); ++i)
+    {
+        EXPECT_EQ(nodes[i].path, all[i]);
+        EXPECT_TRUE(m_groups.contains(all[i]) || m_dsets.contains(all[i]));
+    }
+
+    // object types are retrieved without opening each node
+    for (auto const& info : qAsConst(nodes))
+    {
+        EXPECT_EQ(info.isGroup(), m_groups.contains(info.path));
+        EXPECT_EQ(info.isDataSet(), m_dsets.contains(info.path));
+    }
+}
+
+TEST_F(TestH5Iteration, children)
+{
+    GenH5::File file{h5TestHelper->newFilePath(), GenH5::Create};
+    ASSERT_TRUE(file.isValid());
+
+    auto root = file.root();
+
+    for (auto const& info : root.children())
+    {
+        ADD_FAILURE() << "unexpected node: " << info.path.constData();
+    }
+
+    createFileStructure(root);
+
+    // same nodes in the same order as findChildNodes
+    for (auto iterType : {GenH5::FindDirectOnly, GenH5::FindRecursive})
+    {
+        for (auto filter : {GenH5::NoFilter, GenH5::FilterGroups,
+                            GenH5::FilterDataSets})
+        {
+            auto expected = root.findChildNodes(iterType, filter);
+
+            GenH5::Vector<GenH5::NodeInfo> nodes;
+            for (auto const& info : root.children(iterType, filter)
+                                        .setResolveTypes())
+            {
+                nodes.push_back(info);
+            }
+
+            ASSERT_EQ(nodes.size(), expected.size());
+            for (int i = 0; i < nodes.size(); ++i)
+            {
+                EXPECT_EQ(nodes[i].path, expected[i].path);
+                EXPECT_EQ(nodes[i].type, expected[i].type);
+            }
+        }
+    }
+
+    // object types are not retrieved for direct, unfiltered iterations
+    auto expected = root.findChildNodeNames();
+    GenH5::Vector<QByteArray> names;
+    for (auto const& info : root.children())
+    {
+        EXPECT_EQ(info.type, GenH5::IdType::BadId);
+        names.push_back(info.path);
+    }
+    EXPECT_EQ(names, expected);
+
+    // more links than retrieved by a single step
+    auto large = root.createGroup(QByteArrayLiteral("large"));
+    for (int i = 0; i < 600; ++i)
+    {
+        large.createGroup(QByteArray::number(i));
+    }
+    auto largeNames = large.findChildNodeNames();
+    ASSERT_EQ(largeNames.size(), 600);
+    int nLarge = 0;
+    for (auto const& info : large.children(GenH5::FindRecursive,
+                                           GenH5::FilterGroups))
+    {
+        ASSERT_LT(nLarge, largeNames.size());
+        EXPECT_EQ(info.path, largeNames.at(nLarge++));
+    }
+    EXPECT_EQ(nLarge, 600);
+    large.deleteLink();
+
+    // early exit
+    int count = 0;
+    for (auto const& info : root.children(GenH5::FindRecursive,
+                                          GenH5::FilterDataSets))
+    {
+        ++count;
+        EXPECT_TRUE(info.isDataSet());
+        EXPECT_TRUE(info.toDataSet(root).isValid());
+        break;
+    }
+    EXPECT_EQ(count, 1);
+
+    // depth limit
+    int maxDepth = 0;
+    for (auto const& info : root.children(GenH5::FindRecursive)
+                                .setMaxDepth(2))
+    {
+        maxDepth = std::max(maxDepth, pathDepth(info.path));
+    }
+    EXPECT_EQ(maxDepth, 2);
+
+    // pruning
+    auto children = root.children(GenH5::FindRecursive);
+    GenH5::Vector<QByteArray> paths;
+    for (auto const& info : children)
+    {
+        EXPECT_EQ(children.depth(), pathDepth(info.path));
+        if (info.path == "my_group_2")
+        {
+            children.skipChildren();
+        }
+        paths.push_back(info.path);
+    }
+    EXPECT_TRUE(paths.contains("my_group_2"));
+    EXPECT_TRUE(paths.contains("my_group_1/sub1/dsetA"));
+    EXPECT_FALSE(paths.contains("my_group_2/dset2"));
+    EXPECT_FALSE(paths.contains("my_group_2/C"));
+
+    // can only be iterated once
+    EXPECT_TRUE(children.begin() == children.end());
+}
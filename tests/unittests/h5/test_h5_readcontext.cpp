@@ -0,0 +1,75 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#include "gtest/gtest.h"
+
+#include "genh5_readcontext.h"
+#include "genh5_file.h"
+#include "genh5_group.h"
+
+#include "testhelper.h"
+
+/// This is a test fixture that does a init for each test
+class TestH5ReadContext : public testing::Test
+{
+protected:
+
+    virtual void SetUp() override
+    {
+        file = GenH5::File(h5TestHelper->newFilePath(), GenH5::Create);
+        ASSERT_TRUE(file.isValid());
+
+        // 10 time steps of 6 values each
+        data = h5TestHelper->linearDataVector<double>(60, 0);
+        data.setDimensions({10, 6});
+        dset = file.root().writeDataSet(QByteArrayLiteral("steps"), data);
+        ASSERT_TRUE(dset.isValid());
+    }
+
+    GenH5::File file;
+    GenH5::DataSet dset;
+    GenH5::Data<double> data;
+};
+
+TEST_F(TestH5ReadContext, readAll)
+{
+    GenH5::ReadContext<double> context{dset};
+    EXPECT_TRUE(context.isValid());
+    EXPECT_EQ(context.selectionSize(), 60);
+    EXPECT_EQ(context.dimensions(), (GenH5::Dimensions{10, 6}));
+
+    ASSERT_TRUE(context.read());
+    EXPECT_EQ(context.data(), data.raw());
+    EXPECT_TRUE(context.view().dataSpace() == (GenH5::DataSpace{10, 6}));
+
+    // invalid dataset
+    EXPECT_THROW(GenH5::ReadContext<double>{GenH5::DataSet{}},
+                 GenH5::DataSetException);
+}
+
+TEST_F(TestH5ReadContext, readSteps)
+{
+    // read one time step at a time
+    GenH5::ReadContext<double> context{dset, {1, 6}};
+    EXPECT_EQ(context.selectionSize(), 6);
+    EXPECT_EQ(context.dimensions(), (GenH5::Dimensions{1, 6}));
+
+    GenH5::Dimensions offset{0, 0};
+    for (GenH5::hsize_t t = 0; t < 10; ++t)
+    {
+        offset[0] = t;
+        ASSERT_TRUE(context.read(offset));
+        EXPECT_EQ(context.data(), data.mid(static_cast<int>(t * 6), 6));
+    }
+
+    // out of range
+    offset[0] = 10;
+    EXPECT_FALSE(context.setOffset(offset));
+    EXPECT_FALSE(context.setOffset({0}));
+}
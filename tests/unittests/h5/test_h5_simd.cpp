@@ -0,0 +1,341 @@
+/* GenH5
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * SPDX-License-Identifier: MPL-2.0+
+ *
+ * Created on: 18.10.2026
+ * Author: agent
+ * Email: agent@local
+ */
+
+#include "gtest/gtest.h"
+#include "genh5_simd.h"
+#include "genh5_data.h"
+#include "genh5_datatype.h"
+#include "genh5_exception.h"
+#include "genh5_file.h"
+#include "genh5_float16.h"
+#include "genh5_group.h"
+
+#include "testhelper.h"
+
+#include <H5Tpublic.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+/// This is a test fixture that does a init for each test
+class TestH5Simd : public testing::Test
+{
+protected:
+
+    void TearDown() override
+    {
+        GenH5::setSimdLevel(GenH5::supportedSimdLevel());
+    }
+
+    /// levels to test
+    static GenH5::Vector<GenH5::SimdLevel> levels()
+    {
+        GenH5::Vector<GenH5::SimdLevel> levels{GenH5::SimdScalar};
+        auto supported = GenH5::supportedSimdLevel();
+        if (supported == GenH5::SimdAvx2) levels.push_back(GenH5::SimdSse2);
+        if (supported != GenH5::SimdScalar) levels.push_back(supported);
+        return levels;
+    }
+
+    /// converts the values using HDF5
+    template <typename Src, typename Dst>
+    static GenH5::Vector<Dst> convertHdf5(GenH5::Vector<Src> const& src,
+                                          hid_t srcType, hid_t dstType)
+    {
+        size_t const size = std::max(sizeof(Src), sizeof(Dst));
+        GenH5::Vector<char> buffer(static_cast<int>(src.size() * size));
+        std::memcpy(buffer.data(), src.constData(), src.size() * sizeof(Src));
+
+        EXPECT_GE(H5Tconvert(srcType, dstType, src.size(), buffer.data(),
+                             nullptr, H5P_DEFAULT), 0);
+
+        GenH5::Vector<Dst> dst(src.size());
+        std::memcpy(dst.data(), buffer.constData(), dst.size() * sizeof(Dst));
+        return dst;
+    }
+};
+
+TEST_F(TestH5Simd, simdLevel)
+{
+    EXPECT_EQ(GenH5::simdLevel(), GenH5::supportedSimdLevel());
+
+    GenH5::setSimdLevel(GenH5::SimdScalar);
+    EXPECT_EQ(GenH5::simdLevel(), GenH5::SimdScalar);
+
+    if (GenH5::supportedSimdLevel() != GenH5::SimdNeon)
+    {
+        EXPECT_THROW(GenH5::setSimdLevel(GenH5::SimdNeon),
+                     GenH5::InvalidArgumentError);
+    }
+    EXPECT_EQ(GenH5::simdLevel(), GenH5::SimdScalar);
+}
+
+TEST_F(TestH5Simd, kernelsMatchHdf5)
+{
+    // odd number of elements to test the remaining elements
+    constexpr int n = 1003;
+
+    GenH5::Vector<double> doubles(n);
+    GenH5::Vector<int64_t> int64s(n);
+    GenH5::Vector<uint64_t> uint64s(n);
+    for (int i = 0; i < n; ++i)
+    {
+        doubles[i] = std::ldexp(i % 2 ? -1.0 : 1.0, i % 300 - 150) * 1.1;
+        int64s[i] = (i % 2 ? -1 : 1) * (int64_t{1} << (i % 63)) + i;
+        uint64s[i] = (uint64_t{1} << (i % 64)) + i;
+    }
+    doubles[0] = std::numeric_limits<double>::infinity();
+    doubles[1] = -std::numeric_limits<double>::max();
+    doubles[2] = std::ldexp(1.0, -160);
+    int64s[3] = std::numeric_limits<int64_t>::lowest();
+    int64s[4] = std::numeric_limits<int32_t>::max();
+    uint64s[5] = std::numeric_limits<uint64_t>::max();
+
+    GenH5::Vector<float> floats(n);
+    GenH5::Vector<int32_t> int32s(n);
+    GenH5::Vector<uint32_t> uint32s(n);
+
+    auto floatsHdf5 = convertHdf5<double, float>(
+                doubles, H5T_NATIVE_DOUBLE, H5T_NATIVE_FLOAT);
+    auto int32sHdf5 = convertHdf5<int64_t, int32_t>(
+                int64s, H5T_NATIVE_INT64, H5T_NATIVE_INT32);
+    auto uint32sHdf5 = convertHdf5<uint64_t, uint32_t>(
+                uint64s, H5T_NATIVE_UINT64, H5T_NATIVE_UINT32);
+
+    for (auto level : levels())
+    {
+        SCOPED_TRACE(level);
+        GenH5::setSimdLevel(level);
+
+        using namespace GenH5::details;
+
+        doubleToFloat(doubles.constData(), floats.data(), n);
+        int64ToInt32(int64s.constData(), int32s.data(), n);
+        uint64ToUint32(uint64s.constData(), uint32s.data(), n);
+        for (int i = 0; i < n; ++i)
+        {
+            EXPECT_EQ(floats[i], floatsHdf5[i]) << i;
+            EXPECT_EQ(int32s[i], int32sHdf5[i]) << i;
+            EXPECT_EQ(uint32s[i], uint32sHdf5[i]) << i;
+        }
+
+        // widening is exact
+        GenH5::Vector<double> doublesBack(n);
+        GenH5::Vector<int64_t> int64sBack(n);
+        GenH5::Vector<uint64_t> uint64sBack(n);
+        floatToDouble(floats.constData(), doublesBack.data(), n);
+        int32ToInt64(int32s.constData(), int64sBack.data(), n);
+        uint32ToUint64(uint32s.constData(), uint64sBack.data(), n);
+        for (int i = 0; i < n; ++i)
+        {
+            EXPECT_EQ(doublesBack[i], double(floats[i]));
+            EXPECT_EQ(int64sBack[i], int64_t(int32s[i]));
+            EXPECT_EQ(uint64sBack[i], uint64_t(uint32s[i]));
+        }
+
+        // byte swaps
+        auto swapped64 = convertHdf5<uint64_t, uint64_t>(
+                    uint64s, H5T_STD_U64LE, H5T_STD_U64BE);
+        auto swapped32 = convertHdf5<uint32_t, uint32_t>(
+                    uint32s, H5T_STD_U32LE, H5T_STD_U32BE);
+        GenH5::Vector<uint16_t> uint16s(n);
+        for (int i = 0; i < n; ++i) uint16s[i] = uint16_t(uint32s[i] ^ i);
+        auto swapped16 = convertHdf5<uint16_t, uint16_t>(
+                    uint16s, H5T_STD_U16LE, H5T_STD_U16BE);
+
+        byteSwap64(uint64s.data(), n);
+        byteSwap32(uint32s.data(), n);
+        byteSwap16(uint16s.data(), n);
+        EXPECT_EQ(uint64s, swapped64);
+        EXPECT_EQ(uint32s, swapped32);
+        EXPECT_EQ(uint16s, swapped16);
+        byteSwap64(uint64s.data(), n);
+    }
+}
+
+TEST_F(TestH5Simd, halfKernelsMatchScalar)
+{
+    using namespace GenH5::details;
+
+    // all half precision values
+    constexpr int nHalfs = 1 << 16;
+    GenH5::Vector<uint16_t> halfs(nHalfs);
+    for (int i = 0; i < nHalfs; ++i) halfs[i] = static_cast<uint16_t>(i);
+
+    // floats around the rounding boundaries of all exponents, odd number of
+    // elements to test the remaining elements
+    GenH5::Vector<float> floats;
+    for (int e = -30; e <= 18; ++e)
+    {
+        float const base = std::ldexp(1.0f, e);
+        for (float m : {1.0f, 1.00048828125f, 1.0009765625f, 1.5f, 1.99f})
+        {
+            floats.push_back(base * m);
+            floats.push_back(-std::nextafter(base * m, 0.0f));
+        }
+    }
+    floats.push_back(std::numeric_limits<float>::infinity());
+
+    for (auto level : levels())
+    {
+        SCOPED_TRACE(level);
+        GenH5::setSimdLevel(level);
+
+        GenH5::Vector<float> widened(nHalfs);
+        halfToFloat(halfs.constData(), widened.data(), nHalfs);
+        for (int i = 0; i < nHalfs; ++i)
+        {
+            float const expected = halfBitsToFloat(halfs[i]);
+            if (std::isnan(expected))
+            {
+                EXPECT_TRUE(std::isnan(widened[i])) << i;
+                continue;
+            }
+            EXPECT_EQ(bitCast<uint32_t>(widened[i]),
+                      bitCast<uint32_t>(expected)) << i;
+        }
+
+        GenH5::Vector<uint16_t> narrowed(floats.size());
+        floatToHalf(floats.constData(), narrowed.data(), floats.size());
+        for (int i = 0; i < floats.size(); ++i)
+        {
+            EXPECT_EQ(narrowed[i], floatToHalfBits(floats[i])) << floats[i];
+        }
+    }
+}
+
+TEST_F(TestH5Simd, isConvertible)
+{
+    using GenH5::DataType;
+    using GenH5::details::isSimdConvertible;
+
+    auto be = [](hid_t id){
+        return DataType::fromId(H5Tcopy(id));
+    };
+
+    EXPECT_TRUE(isSimdConvertible(DataType::Double(), DataType::Float()));
+    EXPECT_TRUE(isSimdConvertible(DataType::Float(), DataType::Double()));
+    EXPECT_TRUE(isSimdConvertible(DataType::Int64(), DataType::Int32()));
+    EXPECT_TRUE(isSimdConvertible(DataType::Double(), be(H5T_IEEE_F64BE)));
+    EXPECT_TRUE(isSimdConvertible(DataType::Double(), be(H5T_IEEE_F32BE)));
+    EXPECT_TRUE(isSimdConvertible(DataType::Int32(), be(H5T_STD_I32BE)));
+    EXPECT_TRUE(isSimdConvertible(be(H5T_STD_U16BE), be(H5T_STD_U16LE)));
+
+    // no conversion necessary
+    EXPECT_FALSE(isSimdConvertible(DataType::Double(), DataType::Double()));
+    // different kinds
+    EXPECT_FALSE(isSimdConvertible(DataType::Double(), DataType::Int64()));
+    EXPECT_FALSE(isSimdConvertible(DataType::Int32(), DataType::UInt32()));
+    EXPECT_FALSE(isSimdConvertible(DataType::Int32(), DataType::Char()));
+    EXPECT_FALSE(isSimdConvertible(DataType::Float16(), DataType::Float()));
+    EXPECT_FALSE(isSimdConvertible(DataType::Double(),
+                                   DataType::varString()));
+}
+
+TEST_F(TestH5Simd, dataset)
+{
+    GenH5::File file{h5TestHelper->newFilePath(), GenH5::Create};
+    auto const& root = file.root();
+
+    GenH5::Data<double> doubles{
+        h5TestHelper->linearDataVector<double>(1001, -10, 0.1)
+    };
+    GenH5::Data<int64_t> int64s{
+        h5TestHelper->linearDataVector<int64_t>(1001, -500, 1)
+    };
+    int64s[0] = std::numeric_limits<int64_t>::lowest();
+    int64s[1] = std::numeric_limits<int64_t>::max();
+
+    auto f64be = GenH5::DataType::fromId(H5Tcopy(H5T_IEEE_F64BE));
+    auto const f32be = GenH5::DataType::fromId(H5Tcopy(H5T_IEEE_F32BE));
+    auto i32be = GenH5::DataType::fromId(H5Tcopy(H5T_STD_I32BE));
+
+    for (auto level : levels())
+    {
+        SCOPED_TRACE(level);
+        GenH5::setSimdLevel(level);
+
+        auto suffix = QByteArray::number(level);
+
+        // double in memory, (big endian) float in the file
+        for (auto const* dtype : {&GenH5::DataType::Float(), &f32be})
+        {
+            auto dset = root.createDataSet("float" + suffix, *dtype,
+                                           doubles.dataSpace());
+            EXPECT_TRUE(dset.write(doubles));
+
+            GenH5::Data<double> read;
+            EXPECT_TRUE(dset.read(read));
+            ASSERT_EQ(read.size(), doubles.size());
+            for (int i = 0; i < doubles.size(); ++i)
+            {
+                EXPECT_EQ(read[i], double(float(doubles[i])));
+            }
+
+            GenH5::Data<float> floats;
+            EXPECT_TRUE(dset.read(floats));
+            for (int i = 0; i < doubles.size(); ++i)
+            {
+                EXPECT_EQ(floats[i], float(doubles[i]));
+            }
+            dset.deleteLink();
+        }
+
+        // big endian double in the file
+        {
+            auto dset = root.createDataSet("double" + suffix, f64be,
+                                           doubles.dataSpace());
+            EXPECT_TRUE(dset.write(doubles));
+
+            GenH5::Data<double> read;
+            EXPECT_TRUE(dset.read(read));
+            EXPECT_EQ(read.values(), doubles.values());
+
+            // raw values are big endian
+            GenH5::Vector<uint64_t> raw(doubles.size());
+            EXPECT_TRUE(dset.read(raw.data(), f64be));
+            uint64_t expected;
+            std::memcpy(&expected, &doubles[7], sizeof(expected));
+            GenH5::details::byteSwap64(&expected, 1);
+            EXPECT_EQ(raw[7], expected);
+            dset.deleteLink();
+        }
+
+        // 64 bit integers are clamped
+        {
+            auto dset = root.createDataSet("int" + suffix, i32be,
+                                           int64s.dataSpace());
+            EXPECT_TRUE(dset.write(int64s));
+
+            GenH5::Data<int64_t> read;
+            EXPECT_TRUE(dset.read(read));
+            ASSERT_EQ(read.size(), int64s.size());
+            EXPECT_EQ(read[0], std::numeric_limits<int32_t>::lowest());
+            EXPECT_EQ(read[1], std::numeric_limits<int32_t>::max());
+            for (int i = 2; i < int64s.size(); ++i)
+            {
+                EXPECT_EQ(read[i], int64s[i]);
+            }
+            dset.deleteLink();
+        }
+    }
+
+    // large selections are converted by HDF5 instead of using a buffer of
+    // the size of the selection
+    GenH5::Data<double> large{
+        h5TestHelper->linearDataVector<double>(512 * 1024, 0, 0.5)
+    };
+    auto dset = root.createDataSet("large", f32be, large.dataSpace());
+    EXPECT_TRUE(dset.write(large));
+
+    GenH5::Data<double> read;
+    EXPECT_TRUE(dset.read(read));
+    EXPECT_EQ(read.values(), large.values());
+}
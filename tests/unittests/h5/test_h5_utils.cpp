@@ -71,6 +71,56 @@ TEST_F(TestH5Utils, idx)
     EXPECT_THROW(GenH5::idx(dims4, {1, 3, 4}), GenH5::InvalidArgumentError);
 }
 
+TEST_F(TestH5Utils, dimensions)
+{
+    // stored inline
+    GenH5::Dimensions dims{4, 6, 10};
+    EXPECT_TRUE(dims.isInline());
+    EXPECT_EQ(dims.size(), 3);
+    EXPECT_EQ(dims.capacity(), GenH5::Dimensions::inlineCapacity);
+    EXPECT_EQ(dims.front(), 4);
+    EXPECT_EQ(dims.back(), 10);
+
+    GenH5::Dimensions copy = dims;
+    EXPECT_EQ(copy, dims);
+    copy[1] = 7;
+    EXPECT_NE(copy, dims);
+    EXPECT_EQ(dims[1], 6);
+
+    // compatible to vectors
+    QVector<GenH5::hsize_t> vector = dims;
+    EXPECT_EQ(vector, (QVector<GenH5::hsize_t>{4, 6, 10}));
+    EXPECT_TRUE(vector == dims);
+    EXPECT_TRUE(GenH5::Dimensions{vector} == dims);
+    EXPECT_EQ(dims.toVector(), vector);
+
+    // exceeding the inline capacity allocates a buffer
+    GenH5::Dimensions large(GenH5::Dimensions::inlineCapacity, 1);
+    EXPECT_TRUE(large.isInline());
+    large.push_back(2);
+    EXPECT_FALSE(large.isInline());
+    EXPECT_EQ(large.size(), GenH5::Dimensions::inlineCapacity + 1);
+    EXPECT_EQ(large.back(), 2);
+    EXPECT_EQ(GenH5::prod<int>(large), 2);
+
+    GenH5::Dimensions moved = std::move(large);
+    EXPECT_FALSE(moved.isInline());
+    EXPECT_EQ(moved.size(), GenH5::Dimensions::inlineCapacity + 1);
+    EXPECT_TRUE(large.isEmpty());
+
+    // modifiers
+    dims.insert(dims.begin(), 2);
+    EXPECT_EQ(dims, (GenH5::Dimensions{2, 4, 6, 10}));
+    dims.remove(1, 2);
+    EXPECT_EQ(dims, (GenH5::Dimensions{2, 10}));
+    EXPECT_EQ(dims.indexOf(10), 1);
+    EXPECT_EQ(dims.mid(1), GenH5::Dimensions{10});
+    dims.resize(3);
+    EXPECT_EQ(dims, (GenH5::Dimensions{2, 10, 0}));
+    dims.clear();
+    EXPECT_TRUE(dims.isEmpty());
+}
+
 TEST_F(TestH5Utils, reverseComp)
 {
     auto tuple = std::make_tuple(42.0f, 12, QString{"hello world"});